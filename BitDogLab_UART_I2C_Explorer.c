@@ -12,6 +12,12 @@
 //bibliotecas adicional - para manipulação do display de matriz de leds
 #include "led_matrix.h" // Inclui biblioteca de funções da matriz de LEDs 5x5
 
+//biblioteca adicional - gerenciamento de energia por inatividade
+#include "power_manager.h" // Inclui biblioteca do gerenciador de energia (display, matriz e clock)
+
+//biblioteca adicional - LED RGB de status por PWM
+#include "status_led.h" // Inclui biblioteca do LED RGB de status (PWM de 16 bits e padrões por DMA)
+
 // Definições do display SSD1306 128x64 I2C OLED
 // Configuração i2c para o display OLED
 #define I2C_PORT i2c1 // Define a porta I2C utilizada - porta 1 da bitdoglab
@@ -25,13 +31,15 @@
 #define UART_TX_PIN 0 // Define o pino TX da UART - GPIO 0
 #define UART_RX_PIN 1 // Define o pino RX da UART - GPIO 1
 
-// Definições para LEDs e botões
-#define LED_PIN_R 13    // LED Vermelho 
-#define LED_PIN_B 12    // LED Azul
-#define LED_PIN_G 11    // LED Verde
+// Definições para botões (pinos do LED RGB em status_led.h)
 #define BUTTON_PIN_A 5 // Botão A
 #define BUTTON_PIN_B 6 // Botão B
 
+// Definições do gerenciador de energia
+#define TEMPO_REDUZIR_MS 15000  // Inatividade até reduzir o contraste do display - 15s
+#define TEMPO_APAGAR_MS 60000   // Inatividade até apagar display e matriz - 60s
+#define TEMPO_SONO_MS 120000    // Inatividade até entrar em sono - 120s
+
 // Variáveis globais
 static volatile bool estado_led_verde = false; // Estado do LED Verde (inicialmente desligado) 
 static volatile bool estado_led_azul = false; // Estado do LED Azul (inicialmente desligado)
@@ -41,13 +49,21 @@ static ssd1306_t ssd;  // Definição global do display OLED SSD1306 128x64 I2C
 static void gpio_irq_handler(uint gpio, uint32_t events); // Função de interrupção com debounce e detecção de botão
 void init_uart(void); // Inicializa UART (Comunicação Serial) 
 void init_gpio(void); // Inicializa GPIOs (LEDs e Botões) 
+void atualizar_led_status(void); // Aplica o estado dos LEDs Verde e Azul ao LED RGB de status
 void init_display(void); // Inicializa Display OLED SSD1306 128x64 I2C 
+void init_energia(void); // Inicializa o gerenciador de energia
 void atualizar_display(const char *linha1, const char *linha2); // Atualiza o display com duas mensagens (duas linhas)
 void processar_uart(void); // Processa entrada via UART (Comunicação Serial)
+void processar_caractere(char recebido); // Trata um caractere recebido (letra, número ou outro)
 void desligar_matrix(void); // Desliga a matriz 5x5 e exibe mensagem
 
 // Função de interrupção com debounce e detecção de botão
 void gpio_irq_handler(uint gpio, uint32_t events) {
+    power_manager_activity(); // Qualquer borda (botões ou RX da UART) acorda o sistema
+    if (gpio == UART_RX_PIN) {
+        return; // Borda no RX serve apenas para despertar, o caractere é lido pela UART
+    }
+
     static uint32_t last_time = 0; // Último tempo de pressionamento do botão (inicialmente 0)
     uint32_t current_time = to_us_since_boot(get_absolute_time()); // Tempo atual em microssegundos desde o boot
 
@@ -55,15 +71,17 @@ void gpio_irq_handler(uint gpio, uint32_t events) {
         last_time = current_time; // Atualiza o tempo de pressionamento do botão
 
         // Verifica qual botão foi pressionado e atualiza o estado do LED correspondente e exibe no display OLED SSD1306
+        status_led_clear_state(SYSTEM_UART_OVERFLOW); // O botão reconhece o overrun sinalizado
+
         if (gpio == BUTTON_PIN_A) {
             estado_led_verde = !estado_led_verde; // Inverte o estado do LED Verde  (liga/desliga)
-            gpio_put(LED_PIN_G, estado_led_verde); // Atualiza o estado do LED Verde 
+            atualizar_led_status(); // Atualiza o estado do LED Verde 
             printf("Botão A pressionado: LED Verde %s\n", estado_led_verde ? "Ligado" : "Desligado"); // Exibe mensagem no terminal UART 
             atualizar_display(estado_led_verde ? "LED Verde ON" : "LED Verde off", ""); // Atualiza o display OLED SSD1306 (LED Verde ON/OFF)
         } 
         else if (gpio == BUTTON_PIN_B) {
             estado_led_azul = !estado_led_azul; // Inverte o estado do LED Azul (liga/desliga)
-            gpio_put(LED_PIN_B, estado_led_azul); // Atualiza o estado do LED Azul
+            atualizar_led_status(); // Atualiza o estado do LED Azul
             printf("Botão B pressionado: LED Azul %s\n", estado_led_azul ? "Ligado" : "Desligado"); // Exibe mensagem no terminal UART
             atualizar_display(estado_led_azul ? "LED Azul ON" : "LED Azul off", ""); // Atualiza o display OLED SSD1306 (LED Azul ON/OFF)
         }
@@ -78,22 +96,14 @@ void init_uart(void) {
     gpio_set_function(UART_RX_PIN, GPIO_FUNC_UART); 
     uart_set_hw_flow(UART_ID, false, false);  // Desativa controle de fluxo de hardware (RTS/CTS)
     uart_set_format(UART_ID, 8, 1, UART_PARITY_NONE); // Configura formato de dados da UART (8 bits de dados, 1 bit de parada, sem paridade)
-    uart_set_fifo_enabled(UART_ID, false); // Desativa FIFO da UART (sem buffer)
+    uart_set_fifo_enabled(UART_ID, true); // FIFO de 32 caracteres: o loop principal lê a cada 50ms
     printf("UART Inicializada com sucesso\n"); // Exibe mensagem no terminal UART (Comunicação Serial)
 } 
 
 // Inicializa GPIOs (LEDs e Botões) 
-// Inicializa os pinos dos LEDs e botões como saída ou entrada
-// Configura os LEDs como saída e os botões como entrada com pull-up
+// Inicializa o LED RGB de status (PWM) e os botões como entrada com pull-up
 void init_gpio(void) {
-    gpio_init(LED_PIN_R);
-    gpio_set_dir(LED_PIN_R, GPIO_OUT);
-    
-    gpio_init(LED_PIN_G);
-    gpio_set_dir(LED_PIN_G, GPIO_OUT);
-
-    gpio_init(LED_PIN_B);
-    gpio_set_dir(LED_PIN_B, GPIO_OUT);
+    status_led_init(); // LED RGB nos slices PWM, inicialmente apagado
 
     gpio_init(BUTTON_PIN_A);
     gpio_set_dir(BUTTON_PIN_A, GPIO_IN);
@@ -106,6 +116,23 @@ void init_gpio(void) {
     // Configura interrupção para os botões A e B com detecção de borda de descida (queda)
     gpio_set_irq_enabled_with_callback(BUTTON_PIN_A, GPIO_IRQ_EDGE_FALL, true, &gpio_irq_handler);
     gpio_set_irq_enabled_with_callback(BUTTON_PIN_B, GPIO_IRQ_EDGE_FALL, true, &gpio_irq_handler);
+
+    // Borda de descida no RX (bit de início) também acorda o sistema do estado de sono
+    gpio_set_irq_enabled_with_callback(UART_RX_PIN, GPIO_IRQ_EDGE_FALL, true, &gpio_irq_handler);
+}
+
+// Aplica o estado dos LEDs Verde e Azul (alternados pelos botões) ao LED RGB de status
+// A cor resultante passa a ser o efeito do estado ocioso do sistema; um overrun
+// sinalizado continua piscando até ser reconhecido por um botão
+void atualizar_led_status(void) {
+    status_led_effect_t ocioso = {
+        .r = 0,
+        .g = estado_led_verde ? 255 : 0,
+        .b = estado_led_azul ? 255 : 0,
+        .pattern = STATUS_LED_SOLID,
+    };
+    status_led_map_state(SYSTEM_IDLE, &ocioso);
+    status_led_restore();
 }
 
 // Inicializa Display OLED SSD1306 128x64 I2C 
@@ -127,13 +154,40 @@ void init_display(void) {
     ssd1306_send_data(&ssd);
 }
 
+// Inicializa o gerenciador de energia
+// Após inatividade reduz o contraste, depois apaga display e matriz e reduz clk_sys,
+// e por fim entra em sono (dormant sem USB) até uma borda nos botões ou no RX da UART
+void init_energia(void) {
+    power_config_t config = {
+        .timeouts = {
+            .dim_ms = TEMPO_REDUZIR_MS,
+            .blank_ms = TEMPO_APAGAR_MS,
+            .sleep_ms = TEMPO_SONO_MS,
+        },
+        .active_khz = 125000, // Clock padrão do RP2040
+        .blank_khz = 48000,
+        .sleep_khz = 24000,
+        .contrast_active = 0xFF,
+        .contrast_dim = 0x10,
+        .i2c = I2C_PORT,
+        .i2c_baud = 400 * 1000,
+        .uart = UART_ID,
+        .uart_baud = BAUD_RATE,
+        .wake_pins = {BUTTON_PIN_A, BUTTON_PIN_B, UART_RX_PIN}, // Também têm IRQ em init_gpio()
+        .wake_pin_count = 3,
+    };
+    power_manager_init(&config, &ssd);
+}
+
 // Atualiza o display com duas mensagens (duas linhas) 
 void atualizar_display(const char *linha1, const char *linha2) {
     printf("Atualizando display: %s | %s\n", linha1, linha2);
     ssd1306_fill(&ssd, false); // Limpa o display com cor preta
     ssd1306_draw_string(&ssd, linha1, 10, 10); // Primeira linha no topo do display
     ssd1306_draw_string(&ssd, linha2, 10, 30); // Segunda linha abaixo da primeira
+    status_led_show_state(SYSTEM_BUSY); // Sinaliza o barramento I2C ocupado
     ssd1306_send_data(&ssd);
+    status_led_restore(); // Volta ao estado anterior (ocioso ou overrun)
 }
 
 // Desliga a matriz 5x5 e exibe mensagem 
@@ -144,38 +198,59 @@ void desligar_matrix(void) {
     printf("Matrix 5x5 desligada\n"); // Exibe mensagem no terminal UART
 }
 
+// Trata um caractere recebido pela UART ou pelo USB
+void processar_caractere(char recebido) {
+    power_manager_activity(); // Entrada recebida, sai do modo de economia
+    power_manager_update();
+    printf("Recebido via UART: %c\n", recebido); // Exibe caractere recebido no terminal UART
+
+    // Se for uma letra, exibe no display e desliga a matriz de LEDs 
+    // Exibe a letra no display OLED SSD1306 e desliga a matriz de LEDs
+    // Exibe a letra no terminal UART
+    if ((recebido >= 'A' && recebido <= 'Z') || (recebido >= 'a' && recebido <= 'z')) {
+        char mensagem[20];
+        snprintf(mensagem, sizeof(mensagem), "Letra: %c", recebido);
+        desligar_matrix();  // Desliga a matriz
+        atualizar_display("Matrix 5x5 off", mensagem); // Primeira linha "Matrix 5x5 off", segunda linha mostra a letra
+        printf("Letra recebida e enviada ao OLED: %c\n", recebido);
+    } 
+    // Se for um número, exibe na matriz de LEDs e no display OLED SSD1306 
+    else if (recebido >= '0' && recebido <= '9') {
+        int numero = recebido - '0'; // Converte caractere numérico para inteiro (0-9)
+        printf("Número recebido via UART: %d\n", numero);
+        led_matrix_display_number(numero);  // Exibe o número na matriz de LEDs 5x5 
+        char mensagem[20]; // Exibe o número no display OLED SSD1306 
+        snprintf(mensagem, sizeof(mensagem), "Número: %d", numero);
+        atualizar_display("", mensagem); // Apenas exibe o número, sem "Matrix 5x5 off"
+    }
+    // Se for qualquer outro caractere especial, também desliga a matriz
+    // Exibe mensagem no display OLED SSD1306 e no terminal UART 
+    else {
+        desligar_matrix();
+        atualizar_display("Matrix 5x5 off", ""); // Apenas exibe que a matriz foi desligada
+    }
+}
+
 // Processa entrada via UART (Comunicação Serial) 
+// Lê os caracteres da UART0 (GPIO 0/1) e do USB; ambos são tratados da mesma forma
 void processar_uart(void) {
+    // Esvazia a FIFO da UART0: cada caractere pode levar uma atualização do display,
+    // então uma rajada maior que a FIFO perde dados e gera overrun
+    while (uart_is_readable(UART_ID)) {
+        processar_caractere(uart_getc(UART_ID));
+    }
+
+    // Overrun na UART (FIFO cheia, caractere perdido): sinaliza no LED RGB
+    if (uart_get_hw(UART_ID)->rsr & UART_UARTRSR_OE_BITS) {
+        hw_clear_bits(&uart_get_hw(UART_ID)->rsr, UART_UARTRSR_OE_BITS); // Limpa o indicador de overrun
+        status_led_show_state(SYSTEM_UART_OVERFLOW);
+        printf("UART: overrun detectado\n");
+    }
+
     if (stdio_usb_connected()) {  // Certifica-se de que o USB está conectado para evitar erros de leitura 
-        char recebido;
-        if (scanf("%c", &recebido) == 1) {  // Lê caractere da entrada padrão (UART) 
-            printf("Recebido via UART: %c\n", recebido); // Exibe caractere recebido no terminal UART
-
-            // Se for uma letra, exibe no display e desliga a matriz de LEDs 
-            // Exibe a letra no display OLED SSD1306 e desliga a matriz de LEDs
-            // Exibe a letra no terminal UART
-            if ((recebido >= 'A' && recebido <= 'Z') || (recebido >= 'a' && recebido <= 'z')) {
-                char mensagem[20];
-                snprintf(mensagem, sizeof(mensagem), "Letra: %c", recebido);
-                desligar_matrix();  // Desliga a matriz
-                atualizar_display("Matrix 5x5 off", mensagem); // Primeira linha "Matrix 5x5 off", segunda linha mostra a letra
-                printf("Letra recebida e enviada ao OLED: %c\n", recebido);
-            } 
-            // Se for um número, exibe na matriz de LEDs e no display OLED SSD1306 
-            else if (recebido >= '0' && recebido <= '9') {
-                int numero = recebido - '0'; // Converte caractere numérico para inteiro (0-9)
-                printf("Número recebido via UART: %d\n", numero);
-                led_matrix_display_number(numero);  // Exibe o número na matriz de LEDs 5x5 
-                char mensagem[20]; // Exibe o número no display OLED SSD1306 
-                snprintf(mensagem, sizeof(mensagem), "Número: %d", numero);
-                atualizar_display("", mensagem); // Apenas exibe o número, sem "Matrix 5x5 off"
-            }
-            // Se for qualquer outro caractere especial, também desliga a matriz
-            // Exibe mensagem no display OLED SSD1306 e no terminal UART 
-            else {
-                desligar_matrix();
-                atualizar_display("Matrix 5x5 off", ""); // Apenas exibe que a matriz foi desligada
-            }
+        int lido = getchar_timeout_us(0); // Leitura sem bloqueio para o loop principal continuar gerenciando energia
+        if (lido != PICO_ERROR_TIMEOUT) {  // Lê caractere da entrada padrão (USB) 
+            processar_caractere((char)lido);
         }
     }
 }
@@ -186,13 +261,15 @@ int main() {
     init_gpio(); // Inicializa GPIOs (LEDs e Botões)
     init_display(); // Inicializa Display OLED SSD1306 128x64 I2C 
     led_matrix_init(); // Inicializa a matriz de LEDs 5x5
+    init_energia(); // Inicializa o gerenciador de energia
 
     // Exibe mensagem no terminal UART
     printf("Sistema iniciado. Digite letras ou números no terminal UART.\n");
 
     while (true) {
         processar_uart(); // Processa entrada da UART (Comunicação Serial) 
-        sleep_ms(50); // Aguarda 50ms para evitar sobrecarga do processador
+        power_manager_update(); // Ajusta display, matriz e clock conforme a inatividade
+        power_manager_wait(50); // Aguarda 50ms (ou, em sono, até a próxima interrupção)
     }
 
     return 0;
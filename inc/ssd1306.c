@@ -1,3 +1,4 @@
+#include <string.h>
 #include "ssd1306.h"
 #include "font.h"
 
@@ -52,6 +53,24 @@ void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
   );
 }
 
+void ssd1306_set_contrast(ssd1306_t *ssd, uint8_t contrast) {
+  ssd1306_command(ssd, SET_CONTRAST);
+  ssd1306_command(ssd, contrast);
+}
+
+// Desliga o painel e a bomba de carga (a RAM do display é preservada)
+void ssd1306_set_power(ssd1306_t *ssd, bool on) {
+  if (on) {
+    ssd1306_command(ssd, SET_CHARGE_PUMP);
+    ssd1306_command(ssd, 0x14);
+    ssd1306_command(ssd, SET_DISP | 0x01);
+  } else {
+    ssd1306_command(ssd, SET_DISP | 0x00);
+    ssd1306_command(ssd, SET_CHARGE_PUMP);
+    ssd1306_command(ssd, 0x10);
+  }
+}
+
 void ssd1306_send_data(ssd1306_t *ssd) {
   ssd1306_command(ssd, SET_COL_ADDR);
   ssd1306_command(ssd, 0);
@@ -68,8 +87,41 @@ void ssd1306_send_data(ssd1306_t *ssd) {
   );
 }
 
-void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
-  uint16_t index = (y >> 3) + (x << 3) + 1;
+// Preenche o trecho [y0, y1] da coluna x com máscaras de byte (coordenadas já recortadas)
+// No modo de endereçamento vertical cada coluna ocupa ssd->pages bytes consecutivos
+static void column_span(ssd1306_t *ssd, int x, int y0, int y1, bool value) {
+  uint8_t *column = ssd->ram_buffer + 1 + x * ssd->pages;
+  int p0 = y0 >> 3;
+  int p1 = y1 >> 3;
+  for (int p = p0; p <= p1; ++p) {
+    uint8_t mask = 0xFF;
+    if (p == p0)
+      mask &= (uint8_t)(0xFF << (y0 & 7));
+    if (p == p1)
+      mask &= (uint8_t)(0xFF >> (7 - (y1 & 7)));
+    if (value)
+      column[p] |= mask;
+    else
+      column[p] &= ~mask;
+  }
+}
+
+// Preenche o retângulo [x0, x1] x [y0, y1] após intersecção com a tela
+// Retângulos vazios ou totalmente fora da tela são rejeitados antes de qualquer escrita
+static void fill_clipped(ssd1306_t *ssd, int x0, int y0, int x1, int y1, bool value) {
+  if (x0 < 0) x0 = 0;
+  if (y0 < 0) y0 = 0;
+  if (x1 >= ssd->width) x1 = ssd->width - 1;
+  if (y1 >= ssd->height) y1 = ssd->height - 1;
+  if (x0 > x1 || y0 > y1)
+    return;
+  for (int x = x0; x <= x1; ++x)
+    column_span(ssd, x, y0, y1, value);
+}
+
+// Escrita de pixel sem verificação, para coordenadas já recortadas
+static inline void put_pixel(ssd1306_t *ssd, int x, int y, bool value) {
+  uint16_t index = (y >> 3) + x * ssd->pages + 1;
   uint8_t pixel = (y & 0b111);
   if (value)
     ssd->ram_buffer[index] |= (1 << pixel);
@@ -77,109 +129,295 @@ void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
     ssd->ram_buffer[index] &= ~(1 << pixel);
 }
 
-/*
-void ssd1306_fill(ssd1306_t *ssd, bool value) {
-  uint8_t byte = value ? 0xFF : 0x00;
-  for (uint8_t i = 1; i < ssd->bufsize; ++i)
-    ssd->ram_buffer[i] = byte;
-}*/
+void ssd1306_pixel(ssd1306_t *ssd, int16_t x, int16_t y, bool value) {
+  if (x < 0 || y < 0 || x >= ssd->width || y >= ssd->height)
+    return;
+  put_pixel(ssd, x, y, value);
+}
 
 void ssd1306_fill(ssd1306_t *ssd, bool value) {
-    // Itera por todas as posições do display
-    for (uint8_t y = 0; y < ssd->height; ++y) {
-        for (uint8_t x = 0; x < ssd->width; ++x) {
-            ssd1306_pixel(ssd, x, y, value);
+  memset(ssd->ram_buffer + 1, value ? 0xFF : 0x00, ssd->bufsize - 1);
+}
+
+void ssd1306_rect(ssd1306_t *ssd, int16_t top, int16_t left, int16_t width, int16_t height, bool value, bool fill) {
+  if (width <= 0 || height <= 0)
+    return;
+  int right = left + width - 1;
+  int bottom = top + height - 1;
+  if (fill) {
+    fill_clipped(ssd, left, top, right, bottom, value);
+    return;
+  }
+  fill_clipped(ssd, left, top, right, top, value);
+  fill_clipped(ssd, left, bottom, right, bottom, value);
+  fill_clipped(ssd, left, top, left, bottom, value);
+  fill_clipped(ssd, right, top, right, bottom, value);
+}
+
+// Interpola a coordenada a no ponto b do segmento (a0, b0)-(a1, b1), com b0 != b1
+// O produto é feito em 64 bits: com vértices int16_t ele passa de 2^31
+static int32_t interpolate(int32_t a0, int32_t b0, int32_t a1, int32_t b1, int32_t b) {
+  return a0 + (int32_t)((int64_t)(a1 - a0) * (b - b0) / (b1 - b0));
+}
+
+// O laço de Bresenham da linha tem forma fechada: após n passos no eixo maior (dmaj passos
+// no total) o eixo menor avançou off(n) = floor((2 n dmin + dmaj - 1) / (2 dmaj)).
+// O recorte é feito nesse espaço: calcula-se a faixa de passos [first, last] cujos pixels
+// caem na tela e o laço começa direto em first, então a parte visível é idêntica à da
+// linha sem recorte. As contas usam 64 bits, pois os extremos podem estar em toda a faixa de int16_t.
+
+// Divisão com arredondamento para cima (a >= 0, b > 0)
+static int64_t div_ceil(int64_t a, int64_t b) {
+  return (a + b - 1) / b;
+}
+
+// Restringe [first, last] aos passos em que c0 + s * n fica em [0, limit - 1]
+static void clip_major_axis(int32_t c0, int32_t s, int32_t limit, int64_t *first, int64_t *last) {
+  int64_t lo = s > 0 ? -c0 : c0 - (limit - 1);
+  int64_t hi = s > 0 ? limit - 1 - c0 : c0;
+  if (lo > *first)
+    *first = lo;
+  if (hi < *last)
+    *last = hi;
+}
+
+// Restringe [first, last] aos passos em que c0 + s * off(n) fica em [0, limit - 1]
+// off(n) não decresce, então basta achar o primeiro passo com off(n) >= lo e o último com off(n) <= hi
+static void clip_minor_axis(int32_t c0, int32_t s, int32_t limit, int64_t dmaj, int64_t dmin,
+                            int64_t *first, int64_t *last) {
+  int64_t lo = s > 0 ? -c0 : c0 - (limit - 1);
+  int64_t hi = s > 0 ? limit - 1 - c0 : c0;
+  if (hi < 0 || (dmin == 0 && lo > 0)) {
+    *last = *first - 1; // off(n) >= 0 sempre: faixa vazia
+    return;
+  }
+  if (dmin == 0)
+    return; // off(n) = 0 em toda a linha, dentro de [lo, hi]
+  if (lo > 0) {
+    int64_t n = div_ceil(2 * lo * dmaj - dmaj + 1, 2 * dmin);
+    if (n > *first)
+      *first = n;
+  }
+  int64_t n = div_ceil(2 * hi * dmaj + dmaj + 1, 2 * dmin) - 1;
+  if (n < *last)
+    *last = n;
+}
+
+void ssd1306_line(ssd1306_t *ssd, int16_t x0, int16_t y0, int16_t x1, int16_t y1, bool value) {
+    if (x0 == x1 && y0 == y1) {
+        ssd1306_pixel(ssd, x0, y0, value);
+        return;
+    }
+
+    int32_t dx = abs(x1 - x0);
+    int32_t dy = abs(y1 - y0);
+    int32_t sx = (x0 < x1) ? 1 : -1;
+    int32_t sy = (y0 < y1) ? 1 : -1;
+
+    // Eixo maior (a) e menor (b); com dx == dy o eixo x é o maior
+    bool x_major = dx >= dy;
+    int32_t a0 = x_major ? x0 : y0, b0 = x_major ? y0 : x0;
+    int32_t sa = x_major ? sx : sy, sb = x_major ? sy : sx;
+    int32_t dmaj = x_major ? dx : dy, dmin = x_major ? dy : dx;
+
+    int64_t first = 0, last = dmaj;
+    clip_major_axis(a0, sa, x_major ? ssd->width : ssd->height, &first, &last);
+    clip_minor_axis(b0, sb, x_major ? ssd->height : ssd->width, dmaj, dmin, &first, &last);
+    if (first > last)
+        return; // Nenhum pixel da linha cai na tela
+
+    // Estado do laço no primeiro passo visível
+    int32_t two_dmaj = 2 * dmaj;
+    int64_t num = 2 * first * dmin + dmaj - 1;
+    int32_t rem = (int32_t)(num % two_dmaj);
+    int32_t a = a0 + sa * (int32_t)first;
+    int32_t b = b0 + sb * (int32_t)(num / two_dmaj);
+
+    for (int64_t n = first; n <= last; ++n) {
+        if (x_major)
+            put_pixel(ssd, a, b, value);
+        else
+            put_pixel(ssd, b, a, value);
+        a += sa;
+        rem += 2 * dmin;
+        if (rem >= two_dmaj) {
+            rem -= two_dmaj;
+            b += sb;
         }
     }
 }
 
 
-
-void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill) {
-  for (uint8_t x = left; x < left + width; ++x) {
-    ssd1306_pixel(ssd, x, top, value);
-    ssd1306_pixel(ssd, x, top + height - 1, value);
+void ssd1306_hline(ssd1306_t *ssd, int16_t x0, int16_t x1, int16_t y, bool value) {
+  if (x0 > x1) {
+    int16_t t = x0;
+    x0 = x1;
+    x1 = t;
   }
-  for (uint8_t y = top; y < top + height; ++y) {
-    ssd1306_pixel(ssd, left, y, value);
-    ssd1306_pixel(ssd, left + width - 1, y, value);
+  fill_clipped(ssd, x0, y, x1, y, value);
+}
+
+void ssd1306_vline(ssd1306_t *ssd, int16_t x, int16_t y0, int16_t y1, bool value) {
+  if (y0 > y1) {
+    int16_t t = y0;
+    y0 = y1;
+    y1 = t;
   }
+  fill_clipped(ssd, x, y0, x, y1, value);
+}
+
+// Desenha quatro quartos de círculo de raio r centrados nos cantos (cl, ct), (cr, ct),
+// (cl, cb) e (cr, cb), unidos por segmentos retos. Com cl == cr e ct == cb é um círculo.
+// Algoritmo do ponto médio, apenas com inteiros; no preenchimento cada passo gera linhas horizontais.
+static void rounded_shape(ssd1306_t *ssd, int cl, int ct, int cr, int cb, int r, bool value, bool fill) {
+  if (r < 0 || cr + r < 0 || cb + r < 0 || cl - r >= ssd->width || ct - r >= ssd->height)
+    return; // Figura vazia ou totalmente fora da tela
 
   if (fill) {
-    for (uint8_t x = left + 1; x < left + width - 1; ++x) {
-      for (uint8_t y = top + 1; y < top + height - 1; ++y) {
-        ssd1306_pixel(ssd, x, y, value);
-      }
+    fill_clipped(ssd, cl - r, ct, cr + r, cb, value);
+  } else {
+    fill_clipped(ssd, cl, ct - r, cr, ct - r, value);
+    fill_clipped(ssd, cl, cb + r, cr, cb + r, value);
+    fill_clipped(ssd, cl - r, ct, cl - r, cb, value);
+    fill_clipped(ssd, cr + r, ct, cr + r, cb, value);
+  }
+
+  int x = r;
+  int y = 0;
+  int err = 1 - r;
+  while (x >= y) {
+    if (fill) {
+      fill_clipped(ssd, cl - x, ct - y, cr + x, ct - y, value);
+      fill_clipped(ssd, cl - y, ct - x, cr + y, ct - x, value);
+      fill_clipped(ssd, cl - x, cb + y, cr + x, cb + y, value);
+      fill_clipped(ssd, cl - y, cb + x, cr + y, cb + x, value);
+    } else {
+      ssd1306_pixel(ssd, cr + x, ct - y, value);
+      ssd1306_pixel(ssd, cr + y, ct - x, value);
+      ssd1306_pixel(ssd, cl - x, ct - y, value);
+      ssd1306_pixel(ssd, cl - y, ct - x, value);
+      ssd1306_pixel(ssd, cr + x, cb + y, value);
+      ssd1306_pixel(ssd, cr + y, cb + x, value);
+      ssd1306_pixel(ssd, cl - x, cb + y, value);
+      ssd1306_pixel(ssd, cl - y, cb + x, value);
+    }
+    ++y;
+    if (err < 0) {
+      err += 2 * y + 1;
+    } else {
+      --x;
+      err += 2 * (y - x) + 1;
     }
   }
 }
 
-void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value) {
-    int dx = abs(x1 - x0);
-    int dy = abs(y1 - y0);
-
-    int sx = (x0 < x1) ? 1 : -1;
-    int sy = (y0 < y1) ? 1 : -1;
+void ssd1306_circle(ssd1306_t *ssd, int16_t cx, int16_t cy, int16_t radius, bool value, bool fill) {
+  rounded_shape(ssd, cx, cy, cx, cy, radius, value, fill);
+}
 
-    int err = dx - dy;
+void ssd1306_round_rect(ssd1306_t *ssd, int16_t top, int16_t left, int16_t width, int16_t height, int16_t radius, bool value, bool fill) {
+  if (width <= 0 || height <= 0)
+    return;
+  int r = radius;
+  if (r > (width - 1) / 2)
+    r = (width - 1) / 2;
+  if (r > (height - 1) / 2)
+    r = (height - 1) / 2;
+  if (r < 0)
+    r = 0;
+  int right = left + width - 1;
+  int bottom = top + height - 1;
+  rounded_shape(ssd, left + r, top + r, right - r, bottom - r, r, value, fill);
+}
 
-    while (true) {
-        ssd1306_pixel(ssd, x0, y0, value); // Desenha o pixel atual
+// Polígono definido por count vértices; o preenchimento usa varredura por linhas com
+// interseções inteiras (regra par-ímpar) e é limitado às linhas visíveis da tela
+void ssd1306_polygon(ssd1306_t *ssd, const ssd1306_point_t *points, uint8_t count, bool value, bool fill) {
+  if (count == 0 || count > SSD1306_POLYGON_MAX_POINTS)
+    return;
 
-        if (x0 == x1 && y0 == y1) break; // Termina quando alcança o ponto final
+  int min_x = points[0].x, max_x = points[0].x;
+  int min_y = points[0].y, max_y = points[0].y;
+  for (uint8_t i = 1; i < count; ++i) {
+    if (points[i].x < min_x) min_x = points[i].x;
+    if (points[i].x > max_x) max_x = points[i].x;
+    if (points[i].y < min_y) min_y = points[i].y;
+    if (points[i].y > max_y) max_y = points[i].y;
+  }
+  if (max_x < 0 || max_y < 0 || min_x >= ssd->width || min_y >= ssd->height)
+    return; // Caixa envolvente fora da tela
 
-        int e2 = err * 2;
+  if (fill) {
+    int y_start = min_y < 0 ? 0 : min_y;
+    int y_end = max_y >= ssd->height ? ssd->height - 1 : max_y;
+    int nodes[SSD1306_POLYGON_MAX_POINTS];
 
-        if (e2 > -dy) {
-            err -= dy;
-            x0 += sx;
+    for (int y = y_start; y <= y_end; ++y) {
+      int n = 0;
+      for (uint8_t i = 0, j = count - 1; i < count; j = i++) {
+        int32_t yi = points[i].y, yj = points[j].y;
+        if ((yi <= y && yj > y) || (yj <= y && yi > y)) {
+          nodes[n++] = interpolate(points[i].x, yi, points[j].x, yj, y);
         }
-
-        if (e2 < dx) {
-            err += dx;
-            y0 += sy;
+      }
+      // Ordenação por inserção: n é pequeno e limitado pelo número de vértices
+      for (int i = 1; i < n; ++i) {
+        int v = nodes[i];
+        int k = i - 1;
+        while (k >= 0 && nodes[k] > v) {
+          nodes[k + 1] = nodes[k];
+          --k;
         }
+        nodes[k + 1] = v;
+      }
+      for (int i = 0; i + 1 < n; i += 2)
+        fill_clipped(ssd, nodes[i], y, nodes[i + 1], y, value);
     }
-}
-
+  }
 
-void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value) {
-  for (uint8_t x = x0; x <= x1; ++x)
-    ssd1306_pixel(ssd, x, y, value);
+  // Contorno (também fecha as bordas inferiores deixadas pela regra de varredura)
+  for (uint8_t i = 0, j = count - 1; i < count; j = i++)
+    ssd1306_line(ssd, points[j].x, points[j].y, points[i].x, points[i].y, value);
 }
 
-void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value) {
-  for (uint8_t y = y0; y <= y1; ++y)
-    ssd1306_pixel(ssd, x, y, value);
-}
+// Copia um bitmap opaco em colunas de 8 bits (bit 0 no topo), como as fontes de font.h
+// Apenas a intersecção do bitmap com a tela é percorrida; cada byte de origem é escrito
+// com máscara em até duas páginas do buffer, sem operações por pixel
+void ssd1306_blit(ssd1306_t *ssd, const uint8_t *bitmap, int16_t x, int16_t y, uint8_t width, uint8_t height) {
+  int x0 = x < 0 ? -x : 0;
+  int y0 = y < 0 ? -y : 0;
+  int x1 = (x + width > ssd->width) ? ssd->width - x : width;
+  int y1 = (y + height > ssd->height) ? ssd->height - y : height;
+  if (x0 >= x1 || y0 >= y1)
+    return;
 
-/*
-//Função anterior para desenhar um caractere Maiúsculo
-// Função para desenhar um caractere
-void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
-{
-  uint16_t index = 0;
-  char ver=c;
-  if (c >= 'A' && c <= 'Z')
-  {
-    index = (c - 'A' + 11) * 8; // Para letras maiúsculas
-  }else  if (c >= '0' && c <= '9')
-  {
-    index = (c - '0' + 1) * 8; // Adiciona o deslocamento necessário
-  }
-  
-  for (uint8_t i = 0; i < 8; ++i)
-  {
-    uint8_t line = font[index + i];
-    for (uint8_t j = 0; j < 8; ++j)
-    {
-      ssd1306_pixel(ssd, x + i, y + j, line & (1 << j));
+  int stride = (height + 7) / 8; // Bytes por coluna do bitmap
+  for (int i = x0; i < x1; ++i) {
+    const uint8_t *src = bitmap + i * stride;
+    uint8_t *column = ssd->ram_buffer + 1 + (x + i) * ssd->pages;
+    for (int k = y0 >> 3; k <= (y1 - 1) >> 3; ++k) {
+      // Linhas visíveis deste byte de origem
+      int first = y0 - 8 * k;
+      int last = y1 - 1 - 8 * k;
+      uint8_t mask = 0xFF;
+      if (first > 0)
+        mask &= (uint8_t)(0xFF << first);
+      if (last < 7)
+        mask &= (uint8_t)(0xFF >> (7 - last));
+      uint8_t data = src[k] & mask;
+
+      int ty = y + 8 * k;
+      int page = ty >> 3; // Deslocamento aritmético: ty pode ser negativo
+      int shift = ty & 7;
+      if (page >= 0)
+        column[page] = (column[page] & ~(uint8_t)(mask << shift)) | (uint8_t)(data << shift);
+      if (shift && page + 1 >= 0 && page + 1 < ssd->pages)
+        column[page + 1] = (column[page + 1] & ~(uint8_t)(mask >> (8 - shift))) | (uint8_t)(data >> (8 - shift));
     }
   }
 }
-*/
 
-void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
+void ssd1306_draw_char(ssd1306_t *ssd, char c, int16_t x, int16_t y)
 {
     uint16_t index = 0;
 
@@ -193,17 +431,12 @@ void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
         return; // Caractere não suportado
     }
 
-    for (uint8_t i = 0; i < 8; ++i) {
-        uint8_t line = font[index + i];
-        for (uint8_t j = 0; j < 8; ++j) {
-            ssd1306_pixel(ssd, x + i, y + j, line & (1 << j));
-        }
-    }
+    ssd1306_blit(ssd, &font[index], x, y, 8, 8);
 }
 
 
 // Função para desenhar uma string
-void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y)
+void ssd1306_draw_string(ssd1306_t *ssd, const char *str, int16_t x, int16_t y)
 {
   while (*str)
   {
@@ -219,4 +452,4 @@ void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y)
       break;
     }
   }
-}
\ No newline at end of file
+}
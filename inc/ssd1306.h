@@ -1,9 +1,13 @@
+#ifndef SSD1306_H
+#define SSD1306_H
+
 #include <stdlib.h>
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
 
 #define WIDTH 128
 #define HEIGHT 64
+#define SSD1306_POLYGON_MAX_POINTS 16
 
 typedef enum {
   SET_CONTRAST = 0x81,
@@ -34,16 +38,28 @@ typedef struct {
   uint8_t port_buffer[2];
 } ssd1306_t;
 
+typedef struct {
+  int16_t x, y;
+} ssd1306_point_t;
+
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
 void ssd1306_config(ssd1306_t *ssd);
 void ssd1306_command(ssd1306_t *ssd, uint8_t command);
 void ssd1306_send_data(ssd1306_t *ssd);
+void ssd1306_set_contrast(ssd1306_t *ssd, uint8_t contrast);
+void ssd1306_set_power(ssd1306_t *ssd, bool on);
 
-void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value);
+void ssd1306_pixel(ssd1306_t *ssd, int16_t x, int16_t y, bool value);
 void ssd1306_fill(ssd1306_t *ssd, bool value);
-void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill);
-void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value);
-void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value);
-void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value);
-void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y);
-void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
\ No newline at end of file
+void ssd1306_rect(ssd1306_t *ssd, int16_t top, int16_t left, int16_t width, int16_t height, bool value, bool fill);
+void ssd1306_round_rect(ssd1306_t *ssd, int16_t top, int16_t left, int16_t width, int16_t height, int16_t radius, bool value, bool fill);
+void ssd1306_line(ssd1306_t *ssd, int16_t x0, int16_t y0, int16_t x1, int16_t y1, bool value);
+void ssd1306_hline(ssd1306_t *ssd, int16_t x0, int16_t x1, int16_t y, bool value);
+void ssd1306_vline(ssd1306_t *ssd, int16_t x, int16_t y0, int16_t y1, bool value);
+void ssd1306_circle(ssd1306_t *ssd, int16_t cx, int16_t cy, int16_t radius, bool value, bool fill);
+void ssd1306_polygon(ssd1306_t *ssd, const ssd1306_point_t *points, uint8_t count, bool value, bool fill);
+void ssd1306_blit(ssd1306_t *ssd, const uint8_t *bitmap, int16_t x, int16_t y, uint8_t width, uint8_t height);
+void ssd1306_draw_char(ssd1306_t *ssd, char c, int16_t x, int16_t y);
+void ssd1306_draw_string(ssd1306_t *ssd, const char *str, int16_t x, int16_t y);
+
+#endif // SSD1306_H
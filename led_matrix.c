@@ -1,59 +1,229 @@
+#include <stdlib.h>     // calloc e free para o buffer de LEDs
 #include "led_matrix.h" // Inclui o arquivo de cabeçalho local com as definições de funções e tipos de dados
 
 // Variáveis globais para controle da matriz de LEDs WS2812
-static PIO np_pio;  // Instância da interface PIO
-static uint sm;     // Máquina de estado usada na PIO
-static npLED_t leds[LED_COUNT]; // Buffer de LEDs armazenando os valores de cor
+static led_matrix_config_t matrix_cfg; // Geometria e pinos em uso
+static npLED_t *leds = NULL;           // Buffer de LEDs na ordem da cadeia física
+static uint32_t *frame = NULL;         // Palavras do quadro em transmissão, lidas pelo DMA
+static uint led_count = 0;             // Total de LEDs da cadeia
+static uint strip_len = 0;             // LEDs por segmento, em matrizes inteiras (o último pode ser menor)
+static PIO strip_pio[LED_MATRIX_MAX_STRIPS]; // Instância PIO de cada segmento
+static uint strip_sm[LED_MATRIX_MAX_STRIPS]; // Máquina de estado de cada segmento
+static int strip_dma[LED_MATRIX_MAX_STRIPS]; // Canal DMA que alimenta a FIFO de cada segmento
+static absolute_time_t frame_end;            // Fim do último quadro, incluindo o reset
+static uint strip_active = 0;                // Segmentos com máquina de estado reservada
+static int program_offset[2] = {-1, -1};     // Offset do programa ws2812b em pio0 e pio1
+static bool matrix_enabled = true;           // Quando falso, envia preto sem perder o buffer
 
-// Mapeia um índice para a posição correta na matriz de LEDs (linha x coluna)
-static int map_index(int row, int col) {
-    return row * COLS + col;
-}
+// Configuração padrão: uma matriz 5x5 da BitDogLab no GPIO 7
+static const led_matrix_config_t default_cfg = {
+    .tile_width = LED_MATRIX_DEFAULT_COLS,
+    .tile_height = LED_MATRIX_DEFAULT_ROWS,
+    .tiles_x = 1,
+    .tiles_y = 1,
+    .layout = LED_LAYOUT_PROGRESSIVE,
+    .tile_layout = LED_LAYOUT_PROGRESSIVE,
+    .strip_count = 1,
+    .strip_pins = {MATRIX_LED_PIN},
+};
 
-// Converte valores RGB para o formato GRB exigido pelo WS2812
+// Converte valores RGB para a palavra de 32 bits enviada à PIO
+// A PIO desloca pela esquerda 24 bits, então os dados GRB ficam nos 24 bits mais significativos
 static uint32_t rgb_to_grb(uint8_t r, uint8_t g, uint8_t b) {
-    return ((uint32_t)g << 16) | ((uint32_t)r << 8) | (uint32_t)b;
+    return ((uint32_t)g << 24) | ((uint32_t)r << 16) | ((uint32_t)b << 8);
+}
+
+// Aguarda o fim do quadro em transmissão: DMA concluído, FIFOs vazias e reset cumprido
+static void wait_frame_done(void) {
+    for (uint s = 0; s < strip_active; s++) {
+        dma_channel_wait_for_finish_blocking(strip_dma[s]);
+        while (!pio_sm_is_tx_fifo_empty(strip_pio[s], strip_sm[s])) {
+            tight_loop_contents();
+        }
+    }
+    busy_wait_until(frame_end);
+}
+
+// Libera as máquinas de estado e canais DMA reservados (o programa PIO permanece carregado)
+static void release_strips(void) {
+    wait_frame_done();
+    for (uint s = 0; s < strip_active; s++) {
+        pio_sm_set_enabled(strip_pio[s], strip_sm[s], false);
+        pio_sm_unclaim(strip_pio[s], strip_sm[s]);
+        dma_channel_unclaim(strip_dma[s]);
+    }
+    strip_active = 0;
+}
+
+// Reserva uma máquina de estado (pio0 e, se esgotada, pio1) e um canal DMA, e configura
+// o pino do segmento. O DMA é cadenciado pelo DREQ de TX da máquina de estado: cada palavra
+// é escrita na FIFO assim que há espaço, sem uso da CPU nem interrupções desativadas.
+static bool claim_strip(uint s, uint pin) {
+    PIO pio = pio0;
+    int sm = pio_claim_unused_sm(pio, false);
+    if (sm < 0) {
+        pio = pio1;
+        sm = pio_claim_unused_sm(pio, false);
+        if (sm < 0) {
+            return false; // Nenhuma máquina de estado livre
+        }
+    }
+
+    uint idx = pio_get_index(pio);
+    if (program_offset[idx] < 0) { // Carrega o programa uma única vez por bloco PIO
+        if (!pio_can_add_program(pio, &ws2812b_program)) {
+            pio_sm_unclaim(pio, (uint)sm);
+            return false;
+        }
+        program_offset[idx] = (int)pio_add_program(pio, &ws2812b_program);
+    }
+
+    int chan = dma_claim_unused_channel(false);
+    if (chan < 0) {
+        pio_sm_unclaim(pio, (uint)sm);
+        return false; // Nenhum canal DMA livre
+    }
+    dma_channel_config c = dma_channel_get_default_config(chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, (uint)sm, true));
+    dma_channel_configure(chan, &c, &pio->txf[sm], NULL, 0, false); // Endereço e contagem em cada quadro
+
+    ws2812b_program_init(pio, (uint)sm, (uint)program_offset[idx], pin); // Configura a PIO para comunicação com os LEDs
+    strip_pio[s] = pio;
+    strip_sm[s] = (uint)sm;
+    strip_dma[s] = chan;
+    return true;
+}
+
+uint led_matrix_width(void) {
+    return (uint)matrix_cfg.tile_width * matrix_cfg.tiles_x;
+}
+
+uint led_matrix_height(void) {
+    return (uint)matrix_cfg.tile_height * matrix_cfg.tiles_y;
+}
+
+uint led_matrix_count(void) {
+    return led_count;
 }
 
-// Define a cor de um pixel específico na matriz de LEDs
+// Define a cor de um pixel específico pelo índice na cadeia de LEDs
 void led_matrix_set_pixel(uint index, uint8_t r, uint8_t g, uint8_t b) {
-    if (index < LED_COUNT) {
+    if (index < led_count) {
         leds[index] = (npLED_t){g, r, b};  // Define as cores no formato GRB
     }
 }
 
-// Inicializa a matriz de LEDs WS2812
+// Define a cor de um pixel pela coordenada (x, y) da tela lógica
+void led_matrix_set_pixel_xy(uint x, uint y, uint8_t r, uint8_t g, uint8_t b) {
+    uint32_t index = led_matrix_map_xy(&matrix_cfg, x, y);
+    if (index != LED_MATRIX_INVALID_INDEX) {
+        led_matrix_set_pixel(index, r, g, b);
+    }
+}
+
+// Inicializa a matriz de LEDs com uma geometria e pinos definidos em tempo de execução
+// Retorna falso se a cadeia não puder ser dividida entre os pinos em matrizes inteiras
+bool led_matrix_init_config(const led_matrix_config_t *config) {
+    uint len = led_matrix_strip_len(config);
+    if (len == 0) {
+        return false;
+    }
+    uint count = (uint)config->tile_width * config->tile_height * config->tiles_x * config->tiles_y;
+
+    release_strips(); // Permite reconfigurar a matriz sem reiniciar a placa
+    free(leds);
+    free(frame);
+    leds = calloc(count, sizeof(npLED_t)); // Buffer inicia com todos os LEDs apagados
+    frame = calloc(count, sizeof(uint32_t));
+    led_count = 0;
+    if (leds == NULL || frame == NULL) {
+        return false;
+    }
+
+    for (uint s = 0; s < config->strip_count; s++) {
+        if (!claim_strip(s, config->strip_pins[s])) {
+            release_strips();
+            return false;
+        }
+        strip_active++;
+    }
+
+    matrix_cfg = *config;
+    led_count = count;
+    strip_len = len;
+    return true;
+}
+
+// Inicializa a matriz de LEDs WS2812 com a configuração padrão da BitDogLab
 void led_matrix_init(void) {
-    uint offset = pio_add_program(pio0, &ws2812b_program); // Carrega o programa PIO
-    np_pio = pio0;
-    sm = pio_claim_unused_sm(np_pio, true); // Obtém uma máquina de estado livre
-    ws2812b_program_init(np_pio, sm, offset, MATRIX_LED_PIN); // Configura a PIO para comunicação com os LEDs
-    led_matrix_clear(); // Limpa a matriz inicializando todos os LEDs como apagados
+    if (!led_matrix_init_config(&default_cfg)) {
+        panic("Falha ao inicializar a matriz de LEDs");
+    }
+    led_matrix_write(); // Garante que todos os LEDs comecem apagados
 }
 
 // Limpa a matriz de LEDs (desliga todos os LEDs)
 void led_matrix_clear(void) {
-    for (uint i = 0; i < LED_COUNT; i++) {
+    for (uint i = 0; i < led_count; i++) {
         led_matrix_set_pixel(i, 0, 0, 0); // Define todos os LEDs para a cor preta (desligado)
     }
 }
 
 // Escreve os dados da matriz de LEDs no barramento WS2812
+// O quadro é convertido para palavras da PIO e cada segmento é transmitido pelo seu canal
+// DMA; todos os canais partem juntos, então o tempo do quadro não cresce com o número de
+// segmentos. A função retorna logo após iniciar o DMA, com as interrupções habilitadas;
+// só espera se o quadro anterior (e o seu reset) ainda não terminou.
 void led_matrix_write(void) {
-    uint32_t save = save_and_disable_interrupts(); // Desativa interrupções para evitar conflitos de tempo
-    for (uint i = 0; i < LED_COUNT; i++) {
-        pio_sm_put_blocking(np_pio, sm, rgb_to_grb(leds[i].R, leds[i].G, leds[i].B)); // Envia dados ao LED
+    wait_frame_done(); // O DMA ainda pode estar lendo frame[]
+    for (uint i = 0; i < led_count; i++) {
+        frame[i] = matrix_enabled ? rgb_to_grb(leds[i].R, leds[i].G, leds[i].B) : 0;
+    }
+
+    uint32_t mask = 0;
+    for (uint s = 0; s < strip_active; s++) {
+        uint first = s * strip_len;
+        uint len = led_count - first < strip_len ? led_count - first : strip_len; // O último pode ser menor
+        dma_channel_set_read_addr(strip_dma[s], &frame[first], false);
+        dma_channel_set_trans_count(strip_dma[s], len, false);
+        mask |= 1u << strip_dma[s];
+    }
+    frame_end = make_timeout_time_us(led_matrix_frame_time_us(strip_len)); // Maior segmento + reset
+    dma_start_channel_mask(mask);
+}
+
+// Liga ou desliga a matriz sem alterar o buffer (usado pelo gerenciador de energia)
+void led_matrix_set_enabled(bool enabled) {
+    if (matrix_enabled != enabled) {
+        matrix_enabled = enabled;
+        led_matrix_write(); // Apaga os LEDs ou restaura a última imagem
+    }
+}
+
+// Recalcula o divisor de clock da PIO após uma mudança de clk_sys (8 MHz, 10 ciclos por bit)
+// Um quadro em andamento termina antes, para não mudar a taxa de bits no meio dele
+void led_matrix_update_clkdiv(void) {
+    wait_frame_done();
+    float div = clock_get_hz(clk_sys) / 8000000.0f;
+    for (uint s = 0; s < strip_active; s++) {
+        pio_sm_set_clkdiv(strip_pio[s], strip_sm[s], div);
+        pio_sm_clkdiv_restart(strip_pio[s], strip_sm[s]);
     }
-    busy_wait_us(300); // Aguarda tempo necessário para atualização correta dos LEDs
-    restore_interrupts(save); // Restaura as interrupções
 }
 
 // Exibe um número de 0 a 9 na matriz de LEDs 5x5
 void led_matrix_display_number(int number) {
     led_matrix_clear(); // Limpa a matriz antes de exibir um novo número
+    if (number < 0 || number > 9) {
+        led_matrix_write();
+        return;
+    }
 
     // Definição de padrões para exibição dos números de 0 a 9 na matriz 5x5
-    static const uint numbers[10][5][5] = {
+    static const uint8_t numbers[10][LED_MATRIX_DEFAULT_ROWS][LED_MATRIX_DEFAULT_COLS] = {
         {{0, 1, 1, 1, 0}, {0, 1, 0, 1, 0}, {0, 1, 0, 1, 0}, {0, 1, 0, 1, 0}, {0, 1, 1, 1, 0}}, // 0
         {{0, 1, 1, 1, 0}, {0, 0, 1, 0, 0}, {0, 0, 1, 0, 0}, {0, 1, 1, 0, 0}, {0, 0, 1, 0, 0}}, // 1
         {{0, 1, 1, 1, 0}, {0, 1, 0, 0, 0}, {0, 0, 1, 0, 0}, {0, 1, 0, 1, 0}, {0, 0, 1, 0, 0}}, // 2
@@ -67,10 +237,10 @@ void led_matrix_display_number(int number) {
     };
 
     // Percorre a matriz 5x5 e ativa os LEDs correspondentes ao número
-    for (uint i = 0; i < 5; i++) {
-        for (uint j = 0; j < 5; j++) {
-            if (numbers[number][i][j]) { 
-                led_matrix_set_pixel(map_index(i, j), 255, 255, 255); // Define os LEDs como branco
+    for (uint i = 0; i < LED_MATRIX_DEFAULT_ROWS; i++) {
+        for (uint j = 0; j < LED_MATRIX_DEFAULT_COLS; j++) {
+            if (numbers[number][i][j]) {
+                led_matrix_set_pixel_xy(j, i, 255, 255, 255); // Define os LEDs como branco
             }
         }
     }
@@ -10,12 +10,15 @@
 #include "hardware/irq.h"
 #include "hardware/timer.h"
 #include "hardware/sync.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
 #include "ws2812b.pio.h"
+#include "led_matrix_map.h" // Geometria, mapeamento e modelo de temporização (sem dependência do SDK)
 
+// Configuração padrão da BitDogLab: uma matriz 5x5 no GPIO 7
 #define MATRIX_LED_PIN 7
-#define LED_COUNT 25
-#define ROWS 5
-#define COLS 5
+#define LED_MATRIX_DEFAULT_ROWS 5
+#define LED_MATRIX_DEFAULT_COLS 5
 
 // Estrutura do LED GRB
 typedef struct {
@@ -25,9 +28,17 @@ typedef struct {
 typedef pixel_t npLED_t;
 
 void led_matrix_init(void);
+bool led_matrix_init_config(const led_matrix_config_t *config);
 void led_matrix_clear(void);
 void led_matrix_write(void);
 void led_matrix_set_pixel(uint index, uint8_t r, uint8_t g, uint8_t b);
+void led_matrix_set_pixel_xy(uint x, uint y, uint8_t r, uint8_t g, uint8_t b);
 void led_matrix_display_number(int number);
+void led_matrix_set_enabled(bool enabled);
+void led_matrix_update_clkdiv(void);
+
+uint led_matrix_width(void);
+uint led_matrix_height(void);
+uint led_matrix_count(void);
 
 #endif // LED_MATRIX_H
@@ -0,0 +1,48 @@
+#include "led_matrix_map.h"
+
+// Mapeia uma coordenada (x, y) da tela lógica para o índice do LED na cadeia física
+uint32_t led_matrix_map_xy(const led_matrix_config_t *config, unsigned x, unsigned y) {
+    unsigned tw = config->tile_width;
+    unsigned th = config->tile_height;
+    if (tw == 0 || th == 0 || x >= tw * config->tiles_x || y >= th * config->tiles_y) {
+        return LED_MATRIX_INVALID_INDEX;
+    }
+
+    unsigned tx = x / tw, px = x % tw; // Matriz e coluna dentro da matriz
+    unsigned ty = y / th, py = y % th; // Matriz e linha dentro da matriz
+
+    // Linhas ímpares invertem o sentido no modo serpentina
+    if (config->tile_layout == LED_LAYOUT_SERPENTINE && (ty & 1)) {
+        tx = config->tiles_x - 1 - tx;
+    }
+    if (config->layout == LED_LAYOUT_SERPENTINE && (py & 1)) {
+        px = tw - 1 - px;
+    }
+
+    uint32_t tile = (uint32_t)ty * config->tiles_x + tx;
+    return tile * tw * th + (uint32_t)py * tw + px;
+}
+
+// LEDs de cada segmento da cadeia: as matrizes são divididas entre os pinos em blocos
+// inteiros (o último segmento pode ter menos matrizes), pois um segmento só pode começar
+// no conector de entrada de uma matriz. Retorna 0 para configurações que não podem ser
+// ligadas assim (geometria vazia, pinos demais ou algum segmento sem matrizes).
+uint32_t led_matrix_strip_len(const led_matrix_config_t *config) {
+    unsigned strips = config->strip_count;
+    unsigned tiles = (unsigned)config->tiles_x * config->tiles_y;
+    unsigned tile_leds = (unsigned)config->tile_width * config->tile_height;
+    if (strips == 0 || strips > LED_MATRIX_MAX_STRIPS || tiles == 0 || tile_leds == 0) {
+        return 0;
+    }
+    unsigned strip_tiles = (tiles + strips - 1) / strips;
+    if ((strips - 1) * strip_tiles >= tiles) {
+        return 0; // O último segmento ficaria vazio (ex.: 4 matrizes em 3 pinos)
+    }
+    return strip_tiles * tile_leds;
+}
+
+// Modelo de temporização: tempo de um quadro completo em microssegundos
+// Os segmentos transmitem em paralelo, então o tempo depende apenas do maior segmento
+uint32_t led_matrix_frame_time_us(unsigned strip_len) {
+    return (uint32_t)strip_len * LED_MATRIX_LED_US + LED_MATRIX_RESET_US;
+}
@@ -0,0 +1,39 @@
+#ifndef LED_MATRIX_MAP_H
+#define LED_MATRIX_MAP_H
+
+// Geometria da matriz de LEDs, mapeamento (x, y) -> índice na cadeia e modelo de
+// temporização. Não depende do Pico SDK, assim também é compilado nos testes no host.
+#include <stdint.h>
+
+// Limites do driver
+#define LED_MATRIX_MAX_STRIPS 8 // 4 máquinas de estado em pio0 + 4 em pio1
+#define LED_MATRIX_INVALID_INDEX 0xFFFFFFFFu // Índice retornado para coordenadas fora da matriz
+
+// Temporização do protocolo WS2812 (800 kHz, 24 bits por LED)
+#define LED_MATRIX_LED_US 30    // Tempo de transmissão de um LED em microssegundos
+#define LED_MATRIX_RESET_US 300 // Tempo em nível baixo para travar os dados (reset/latch)
+
+// Ordem física dos LEDs dentro de uma matriz (ou das matrizes dentro da cadeia)
+typedef enum {
+    LED_LAYOUT_PROGRESSIVE = 0, // Todas as linhas no mesmo sentido
+    LED_LAYOUT_SERPENTINE       // Linhas alternam o sentido (zigzag)
+} led_layout_t;
+
+// Geometria e ligação da matriz de LEDs
+// A tela lógica é formada por tiles_x * tiles_y matrizes de tile_width x tile_height LEDs
+// encadeadas. A cadeia é dividida entre strip_count pinos, cada um com sua própria máquina
+// de estado PIO transmitindo em paralelo; cada segmento recebe matrizes inteiras.
+typedef struct {
+    uint8_t tile_width, tile_height; // LEDs por matriz (colunas x linhas)
+    uint8_t tiles_x, tiles_y;        // Quantidade de matrizes encadeadas (colunas x linhas)
+    led_layout_t layout;             // Mapeamento dos LEDs dentro de cada matriz
+    led_layout_t tile_layout;        // Ordem de encadeamento das matrizes
+    uint8_t strip_count;             // Número de pinos/máquinas de estado em paralelo
+    uint8_t strip_pins[LED_MATRIX_MAX_STRIPS]; // GPIO de cada segmento da cadeia
+} led_matrix_config_t;
+
+uint32_t led_matrix_map_xy(const led_matrix_config_t *config, unsigned x, unsigned y);
+uint32_t led_matrix_strip_len(const led_matrix_config_t *config);
+uint32_t led_matrix_frame_time_us(unsigned strip_len);
+
+#endif // LED_MATRIX_MAP_H
@@ -0,0 +1,197 @@
+#include <stdio.h>
+#include "hardware/clocks.h"
+#include "hardware/gpio.h"
+#include "hardware/pll.h"
+#include "hardware/sync.h"
+#include "hardware/xosc.h"
+#include "hardware/structs/io_bank0.h"
+#include "tusb.h"
+#include "power_manager.h"
+#include "led_matrix.h"
+#include "status_led.h"
+
+// Variáveis globais do gerenciador de energia
+static power_config_t pm_cfg;               // Configuração em uso
+static ssd1306_t *pm_ssd;                   // Display controlado (contraste e liga/desliga)
+static power_state_t pm_state = POWER_ACTIVE; // Estado atual
+static volatile uint32_t last_activity_ms;  // Instante da última entrada (atualizado também em IRQ)
+static volatile uint32_t activity_count;    // Incrementado a cada entrada, encerra a espera em sono
+static uint32_t seen_count;                 // activity_count no início do ciclo atual do loop principal
+
+// Clock de cada estado em kHz
+static uint32_t state_khz(power_state_t state) {
+    switch (state) {
+        case POWER_BLANK: return pm_cfg.blank_khz;
+        case POWER_SLEEP: return pm_cfg.sleep_khz;
+        default: return pm_cfg.active_khz;
+    }
+}
+
+// Altera clk_sys e recalcula os periféricos que dependem dele
+// clk_peri acompanha clk_sys, então a UART também precisa de um novo divisor
+// Com force a reprogramação é feita mesmo se clk_sys já estiver na frequência pedida
+// (após o dormant clk_sys e clk_peri saem do XOSC, não da pll_sys)
+static void set_clock_khz(uint32_t khz, bool force) {
+    if (khz == 0 || (!force && clock_get_hz(clk_sys) == khz * 1000)) {
+        return;
+    }
+    uint32_t save = save_and_disable_interrupts(); // Nenhuma IRQ usa I2C/UART com timings antigos
+    set_sys_clock_khz(khz, false);
+    // Recalcula para o clock efetivo, mesmo se a frequência pedida não for alcançável
+    i2c_set_baudrate(pm_cfg.i2c, pm_cfg.i2c_baud);
+    uart_set_baudrate(pm_cfg.uart, pm_cfg.uart_baud);
+    led_matrix_update_clkdiv();
+    status_led_update_clkdiv();
+    restore_interrupts(save);
+}
+
+// USB enumerado por um host (com ou sem terminal aberto)
+// stdio_usb_connected() só indica DTR ativo; para o dormant o que importa é o host estar
+// usando o dispositivo, pois clk_usb e pll_usb param e o dispositivo deixaria de responder
+static bool usb_mounted(void) {
+    return tud_mounted();
+}
+
+// Habilita a borda de descida de um pino como fonte de despertar do dormant
+// O registrador é escrito diretamente: gpio_set_dormant_irq_enabled() reconhece a borda em
+// INTR, que é compartilhado com a IRQ do processador, e apagaria tanto uma borda ainda não
+// tratada antes do dormant quanto a borda que acordou o sistema
+static void set_dormant_wake(uint gpio, bool enabled) {
+    io_rw_32 *inte = &io_bank0_hw->dormant_wake_irq_ctrl.inte[gpio / 8];
+    uint32_t mask = GPIO_IRQ_EDGE_FALL << (4 * (gpio % 8));
+    if (enabled) {
+        hw_set_bits(inte, mask);
+    } else {
+        hw_clear_bits(inte, mask);
+    }
+}
+
+// Modo dormant do RP2040: todos os clocks param até uma borda de descida em um dos
+// pinos de despertar. Só é usado sem USB enumerado, pois clk_usb também é desligado.
+// Uma borda já registrada em INTR acorda o XOSC imediatamente, e a borda que acorda o
+// sistema continua registrada: quando as interrupções voltam, gpio_irq_handler trata o
+// pressionamento do botão normalmente.
+static void enter_dormant(void) {
+    uint32_t save = save_and_disable_interrupts();
+    uint32_t khz = clock_get_hz(clk_sys) / 1000; // Clock restaurado ao acordar
+    for (uint i = 0; i < pm_cfg.wake_pin_count; i++) {
+        set_dormant_wake(pm_cfg.wake_pins[i], true);
+    }
+    // Entrada recebida desde o início do ciclo (USB, botão ou UART já tratados em IRQ)
+    if (activity_count != seen_count) {
+        for (uint i = 0; i < pm_cfg.wake_pin_count; i++) {
+            set_dormant_wake(pm_cfg.wake_pins[i], false);
+        }
+        restore_interrupts(save);
+        return;
+    }
+
+    // clk_ref e clk_sys passam para o XOSC; PLLs e clocks derivados são desligados
+    clock_configure(clk_ref, CLOCKS_CLK_REF_CTRL_SRC_VALUE_XOSC_CLKSRC, 0, XOSC_HZ, XOSC_HZ);
+    clock_configure(clk_sys, CLOCKS_CLK_SYS_CTRL_SRC_VALUE_CLK_REF, 0, XOSC_HZ, XOSC_HZ);
+    clock_configure(clk_peri, 0, CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLK_SYS, XOSC_HZ, XOSC_HZ);
+    clock_configure(clk_rtc, 0, CLOCKS_CLK_RTC_CTRL_AUXSRC_VALUE_XOSC_CLKSRC, XOSC_HZ, 46875);
+    clock_stop(clk_usb);
+    clock_stop(clk_adc);
+    pll_deinit(pll_sys);
+    pll_deinit(pll_usb);
+
+    xosc_dormant(); // Retorna quando uma borda acorda o XOSC
+    for (uint i = 0; i < pm_cfg.wake_pin_count; i++) {
+        set_dormant_wake(pm_cfg.wake_pins[i], false);
+    }
+
+    // Restaura pll_usb e os clocks derivados dele, depois pll_sys no clock anterior ao dormant
+    pll_init(pll_usb, 1, 1440 * MHZ, 6, 5);
+    clock_configure(clk_usb, 0, CLOCKS_CLK_USB_CTRL_AUXSRC_VALUE_CLKSRC_PLL_USB, 48 * MHZ, 48 * MHZ);
+    clock_configure(clk_adc, 0, CLOCKS_CLK_ADC_CTRL_AUXSRC_VALUE_CLKSRC_PLL_USB, 48 * MHZ, 48 * MHZ);
+    clock_configure(clk_rtc, 0, CLOCKS_CLK_RTC_CTRL_AUXSRC_VALUE_CLKSRC_PLL_USB, 48 * MHZ, 46875);
+    set_clock_khz(khz, true); // Sempre: I2C, UART, PIO e LED de status foram configurados para outro clock
+
+    restore_interrupts(save);
+    power_manager_activity();
+}
+
+// Caracteres recebidos pelo USB (chamada em IRQ pelo stdio)
+static void usb_chars_available(void *param) {
+    (void)param;
+    power_manager_activity();
+}
+
+// Aplica clock, display e matriz de um novo estado
+static void enter_state(power_state_t state) {
+    set_clock_khz(state_khz(state), false); // Ao subir, o clock é restaurado antes de usar o I2C
+
+    bool display_on = (state == POWER_ACTIVE || state == POWER_DIM);
+    if (display_on) {
+        if (pm_state >= POWER_BLANK) {
+            ssd1306_set_power(pm_ssd, true);
+            status_led_restore(); // Volta ao efeito do estado registrado (ocioso ou overrun)
+        }
+        ssd1306_set_contrast(pm_ssd, state == POWER_DIM ? pm_cfg.contrast_dim : pm_cfg.contrast_active);
+    } else if (pm_state < POWER_BLANK) {
+        ssd1306_set_power(pm_ssd, false);
+        status_led_off(); // LED RGB e seu DMA desligados junto com o display
+    }
+    led_matrix_set_enabled(display_on);
+
+    printf("Energia: %s -> %s (%lu kHz)\n", power_state_name(pm_state), power_state_name(state),
+           (unsigned long)(clock_get_hz(clk_sys) / 1000));
+    pm_state = state;
+}
+
+// Inicializa o gerenciador (display e matriz já devem estar inicializados)
+void power_manager_init(const power_config_t *config, ssd1306_t *ssd) {
+    pm_cfg = *config;
+    pm_ssd = ssd;
+    pm_state = POWER_ACTIVE;
+    set_clock_khz(pm_cfg.active_khz, false);
+    ssd1306_set_contrast(pm_ssd, pm_cfg.contrast_active);
+    stdio_set_chars_available_callback(usb_chars_available, NULL); // Entrada USB acorda do sono
+    power_manager_activity();
+    seen_count = activity_count;
+}
+
+// Registra uma entrada do usuário (botões ou UART); pode ser chamada em IRQ
+void power_manager_activity(void) {
+    last_activity_ms = to_ms_since_boot(get_absolute_time());
+    activity_count++;
+}
+
+// Avalia a inatividade e troca de estado quando necessário (chamada no loop principal)
+void power_manager_update(void) {
+    uint32_t idle_ms = power_idle_ms(to_ms_since_boot(get_absolute_time()), last_activity_ms);
+    power_state_t target = power_state_for_idle(&pm_cfg.timeouts, idle_ms);
+    if (target != pm_state) {
+        enter_state(target);
+    }
+}
+
+// Aguarda o próximo ciclo do loop principal
+// Entradas são contadas desde o fim da espera anterior (início do ciclo atual): uma entrada
+// que chega enquanto o loop processa a UART ou atualiza o estado encerra a espera seguinte
+// em vez de ser esquecida até a próxima. A verificação final é feita com as interrupções
+// desativadas; com PRIMASK ativo uma IRQ pendente ainda acorda a CPU do WFI.
+// No estado SLEEP o loop só volta a rodar após uma entrada: sem USB enumerado (bateria
+// ou carregador) o RP2040 entra em dormant; com um host USB a CPU fica em WFI, e as
+// interrupções periódicas do USB (a cada 1 ms) apenas voltam ao WFI sem executar o loop
+void power_manager_wait(uint32_t ms) {
+    if (pm_state != POWER_SLEEP) {
+        sleep_ms(ms);
+    } else if (!usb_mounted()) {
+        enter_dormant();
+    } else {
+        uint32_t save = save_and_disable_interrupts();
+        while (activity_count == seen_count && usb_mounted()) {
+            __wfi();
+            restore_interrupts(save); // Executa o tratador da IRQ que acordou a CPU
+            save = save_and_disable_interrupts();
+        }
+        restore_interrupts(save);
+    }
+    seen_count = activity_count; // Início do próximo ciclo
+}
+
+power_state_t power_manager_state(void) {
+    return pm_state;
+}
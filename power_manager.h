@@ -0,0 +1,34 @@
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "hardware/uart.h"
+#include "inc/ssd1306.h"
+#include "power_state.h"
+
+#define POWER_MAX_WAKE_PINS 4 // GPIOs que acordam o sistema do modo dormant
+
+// Tempos de inatividade, clocks de cada estado e periféricos afetados
+typedef struct {
+    power_timeouts_t timeouts;
+    uint32_t active_khz;   // clk_sys nos estados ACTIVE e DIM
+    uint32_t blank_khz;    // clk_sys no estado BLANK
+    uint32_t sleep_khz;    // clk_sys no estado SLEEP com USB conectado
+    uint8_t contrast_active;
+    uint8_t contrast_dim;
+    i2c_inst_t *i2c;       // Barramento do display (timings recalculados após mudança de clock)
+    uint32_t i2c_baud;
+    uart_inst_t *uart;     // UART de entrada (baud rate recalculado após mudança de clock)
+    uint32_t uart_baud;
+    uint8_t wake_pins[POWER_MAX_WAKE_PINS]; // Bordas de descida nestes pinos acordam do dormant
+    uint8_t wake_pin_count;
+} power_config_t;
+
+void power_manager_init(const power_config_t *config, ssd1306_t *ssd);
+void power_manager_activity(void);
+void power_manager_update(void);
+void power_manager_wait(uint32_t ms);
+power_state_t power_manager_state(void);
+
+#endif // POWER_MANAGER_H
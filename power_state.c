@@ -0,0 +1,31 @@
+#include "power_state.h"
+
+// Estado desejado para um tempo de inatividade (limite 0 desativa o estado)
+power_state_t power_state_for_idle(const power_timeouts_t *timeouts, uint32_t idle_ms) {
+    if (timeouts->sleep_ms && idle_ms >= timeouts->sleep_ms) {
+        return POWER_SLEEP;
+    }
+    if (timeouts->blank_ms && idle_ms >= timeouts->blank_ms) {
+        return POWER_BLANK;
+    }
+    if (timeouts->dim_ms && idle_ms >= timeouts->dim_ms) {
+        return POWER_DIM;
+    }
+    return POWER_ACTIVE;
+}
+
+// Tempo desde a última entrada; a subtração sem sinal continua correta quando o
+// contador de milissegundos de 32 bits dá a volta (a cada ~49,7 dias)
+uint32_t power_idle_ms(uint32_t now_ms, uint32_t last_activity_ms) {
+    return now_ms - last_activity_ms;
+}
+
+const char *power_state_name(power_state_t state) {
+    switch (state) {
+        case POWER_ACTIVE: return "ativo";
+        case POWER_DIM: return "reduzido";
+        case POWER_BLANK: return "apagado";
+        case POWER_SLEEP: return "sono";
+        default: return "?";
+    }
+}
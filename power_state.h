@@ -0,0 +1,27 @@
+#ifndef POWER_STATE_H
+#define POWER_STATE_H
+
+// Máquina de estados do gerenciador de energia. Não depende do Pico SDK, assim
+// também é compilada nos testes no host.
+#include <stdint.h>
+
+// Estados de energia, do maior para o menor consumo
+typedef enum {
+    POWER_ACTIVE = 0, // Clock máximo, display com contraste normal
+    POWER_DIM,        // Display com contraste reduzido
+    POWER_BLANK,      // Display e matriz desligados, clk_sys reduzido
+    POWER_SLEEP       // clk_sys mínimo; dormant sem USB, WFI com USB conectado
+} power_state_t;
+
+// Tempos de inatividade (a partir da última entrada) até cada estado; 0 desativa o estado
+typedef struct {
+    uint32_t dim_ms;   // Inatividade até reduzir o contraste
+    uint32_t blank_ms; // Inatividade até desligar display e matriz
+    uint32_t sleep_ms; // Inatividade até entrar em sono
+} power_timeouts_t;
+
+power_state_t power_state_for_idle(const power_timeouts_t *timeouts, uint32_t idle_ms);
+uint32_t power_idle_ms(uint32_t now_ms, uint32_t last_activity_ms);
+const char *power_state_name(power_state_t state);
+
+#endif // POWER_STATE_H
@@ -0,0 +1,188 @@
+#include "hardware/pwm.h"
+#include "hardware/dma.h"
+#include "hardware/clocks.h"
+#include "hardware/sync.h"
+#include "status_led.h"
+
+// Pinos na ordem R, G, B (mesma ordem de duty[] em status_led_waveform)
+static const uint led_pins[3] = {LED_PIN_R, LED_PIN_G, LED_PIN_B};
+
+static status_led_layout_t layout; // Slices PWM dos pinos e posição de cada canal nas tabelas
+static int dma_chan[3];            // Um canal DMA por slice
+static int rearm_chan[3];          // Canal encadeado que reinicia a contagem de dma_chan[s]
+static const uint32_t rearm_count = 0xFFFFFFFF; // Nova contagem escrita ao fim de cada contagem
+static uint32_t tables[3][STATUS_LED_TABLE_LEN] __attribute__((aligned(STATUS_LED_TABLE_LEN * 4)));
+
+static status_led_effect_t current = {0, 0, 0, STATUS_LED_SOLID, 0}; // Efeito em exibição
+static bool dma_running = false;
+static volatile system_state_t latched_state = SYSTEM_IDLE; // Último estado persistente (SYSTEM_BUSY é transitório)
+
+// Efeito associado a cada estado do sistema
+static status_led_effect_t state_effects[SYSTEM_STATE_COUNT] = {
+    [SYSTEM_IDLE] = {0, 0, 0, STATUS_LED_SOLID, 0},                // Apagado
+    [SYSTEM_BUSY] = {255, 160, 0, STATUS_LED_SOLID, 0},            // Amarelo
+    [SYSTEM_UART_OVERFLOW] = {255, 0, 0, STATUS_LED_BLINK, 500},   // Vermelho piscando
+};
+
+// Configura o slice de temporização para gerar STATUS_LED_TABLE_LEN pedidos de DMA por período
+static void configure_pace(uint16_t period_ms) {
+    status_led_pace_t pace;
+    status_led_pace(clock_get_hz(clk_sys), period_ms, &pace);
+    pwm_set_clkdiv_int_frac(STATUS_LED_PACE_SLICE, pace.div, 0);
+    pwm_set_wrap(STATUS_LED_PACE_SLICE, (uint16_t)(pace.wrap - 1));
+}
+
+// Interrompe a reprodução por DMA, mantendo o último nível nas saídas
+static void stop_dma(void) {
+    if (dma_running) {
+        for (uint s = 0; s < layout.slice_count; s++) {
+            dma_channel_abort(rearm_chan[s]);
+            dma_channel_abort(dma_chan[s]);
+            dma_channel_abort(rearm_chan[s]); // Caso o fim da contagem tenha disparado o encadeamento
+        }
+        dma_running = false;
+    }
+}
+
+static bool same_effect(const status_led_effect_t *a, const status_led_effect_t *b) {
+    return a->r == b->r && a->g == b->g && a->b == b->b && a->pattern == b->pattern &&
+           a->period_ms == b->period_ms;
+}
+
+// Escreve um nível fixo nos três canais
+static void set_levels(const uint16_t duty[3]) {
+    for (uint c = 0; c < 3; c++) {
+        pwm_set_gpio_level(led_pins[c], duty[c]);
+    }
+}
+
+// Inicializa os três canais PWM (16 bits), o slice de temporização e os canais DMA
+// Mesmo a contagem máxima de um canal DMA termina (cerca de 4,7 h com período de 1 ms),
+// então cada canal de dados encadeia um segundo canal que escreve uma nova contagem no
+// registrador que dispara o canal de dados; o endereço de leitura continua no anel
+void status_led_init(void) {
+    status_led_layout_init(&layout, led_pins);
+    for (uint s = 0; s < layout.slice_count; s++) {
+        pwm_config config = pwm_get_default_config();
+        pwm_config_set_wrap(&config, 0xFFFF); // Resolução de 16 bits
+        pwm_init(layout.slices[s], &config, true);
+        dma_chan[s] = dma_claim_unused_channel(true);
+        rearm_chan[s] = dma_claim_unused_channel(true);
+
+        dma_channel_config c = dma_channel_get_default_config(rearm_chan[s]);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+        channel_config_set_read_increment(&c, false);
+        channel_config_set_write_increment(&c, false);
+        dma_channel_configure(rearm_chan[s], &c, &dma_hw->ch[dma_chan[s]].al1_transfer_count_trig,
+                              &rearm_count, 1, false);
+    }
+    for (uint c = 0; c < 3; c++) {
+        hard_assert(layout.slices[layout.pin_slice[c]] == pwm_gpio_to_slice_num(led_pins[c])); // Mapeamento do RP2040
+        gpio_set_function(led_pins[c], GPIO_FUNC_PWM);
+        pwm_set_gpio_level(led_pins[c], 0);
+    }
+
+    pwm_config pace = pwm_get_default_config();
+    pwm_init(STATUS_LED_PACE_SLICE, &pace, true); // O wrap deste slice cadencia o DMA
+}
+
+// Exibe um efeito: cores fixas são escritas diretamente; padrões são gerados em tabelas
+// e reproduzidos pelo DMA a cada wrap do slice de temporização, sem uso da CPU por passo
+// Repetir o efeito em exibição não reinicia o padrão (o pisca continuaria na amostra 0)
+void status_led_play(const status_led_effect_t *effect) {
+    uint32_t save = save_and_disable_interrupts(); // Pode ser chamada no loop principal e em IRQ
+    bool solid = (effect->pattern == STATUS_LED_SOLID || effect->period_ms == 0);
+    if (same_effect(effect, &current) && (solid || dma_running)) {
+        restore_interrupts(save);
+        return;
+    }
+    stop_dma();
+    current = *effect;
+
+    uint16_t duty[3];
+    if (solid) {
+        status_led_waveform(effect, 0, duty);
+        set_levels(duty);
+        restore_interrupts(save);
+        return;
+    }
+
+    status_led_pack(&layout, effect, tables);
+
+    configure_pace(effect->period_ms);
+    pwm_set_counter(STATUS_LED_PACE_SLICE, 0);
+
+    uint32_t mask = 0;
+    for (uint s = 0; s < layout.slice_count; s++) {
+        dma_channel_config c = dma_channel_get_default_config(dma_chan[s]);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+        channel_config_set_read_increment(&c, true);
+        channel_config_set_write_increment(&c, false);
+        channel_config_set_dreq(&c, pwm_get_dreq(STATUS_LED_PACE_SLICE));
+        channel_config_set_ring(&c, false, STATUS_LED_TABLE_BITS + 2); // Leitura em anel sobre a tabela
+        channel_config_set_chain_to(&c, rearm_chan[s]); // Ao fim da contagem, rearm_chan a reinicia
+        dma_channel_configure(dma_chan[s], &c, &pwm_hw->slice[layout.slices[s]].cc, tables[s], 0xFFFFFFFF, false);
+        mask |= 1u << dma_chan[s];
+    }
+    dma_start_channel_mask(mask); // Todos os slices começam na mesma amostra
+    dma_running = true;
+    restore_interrupts(save);
+}
+
+void status_led_off(void) {
+    static const status_led_effect_t off = {0, 0, 0, STATUS_LED_SOLID, 0};
+    status_led_play(&off);
+}
+
+// Associa um efeito a um estado do sistema
+void status_led_map_state(system_state_t state, const status_led_effect_t *effect) {
+    if (state < SYSTEM_STATE_COUNT) {
+        state_effects[state] = *effect;
+    }
+}
+
+// Exibe o efeito de um estado; exceto SYSTEM_BUSY, o estado fica registrado até ser
+// substituído ou limpo, e volta a ser exibido por status_led_restore()
+// SYSTEM_BUSY só é exibido sobre SYSTEM_IDLE: um estado de erro registrado continua
+// piscando sem ser reiniciado a cada transferência
+void status_led_show_state(system_state_t state) {
+    if (state >= SYSTEM_STATE_COUNT) {
+        return;
+    }
+    uint32_t save = save_and_disable_interrupts();
+    if (state == SYSTEM_BUSY && latched_state != SYSTEM_IDLE) {
+        restore_interrupts(save);
+        return;
+    }
+    if (state != SYSTEM_BUSY) {
+        latched_state = state;
+    }
+    status_led_play(&state_effects[state]);
+    restore_interrupts(save);
+}
+
+// Volta ao estado registrado (após SYSTEM_BUSY ou após mudar o efeito de um estado)
+void status_led_restore(void) {
+    uint32_t save = save_and_disable_interrupts();
+    status_led_play(&state_effects[latched_state]);
+    restore_interrupts(save);
+}
+
+// Remove o estado registrado, se for state, voltando a SYSTEM_IDLE
+void status_led_clear_state(system_state_t state) {
+    uint32_t save = save_and_disable_interrupts();
+    if (latched_state == state) {
+        latched_state = SYSTEM_IDLE;
+        status_led_play(&state_effects[SYSTEM_IDLE]);
+    }
+    restore_interrupts(save);
+}
+
+// Recalcula a cadência do DMA após uma mudança de clk_sys
+// Os slices dos LEDs não precisam de ajuste: com wrap de 16 bits a frequência PWM
+// continua acima de 300 Hz mesmo com clk_sys em 24 MHz
+void status_led_update_clkdiv(void) {
+    if (dma_running) {
+        configure_pace(current.period_ms);
+    }
+}
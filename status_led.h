@@ -0,0 +1,32 @@
+#ifndef STATUS_LED_H
+#define STATUS_LED_H
+
+#include "pico/stdlib.h"
+#include "status_led_wave.h" // Efeitos, correção gama e geração das tabelas (sem dependência do SDK)
+
+// Pinos do LED RGB da BitDogLab
+#define LED_PIN_R 13    // LED Vermelho (PWM slice 6, canal B)
+#define LED_PIN_B 12    // LED Azul (PWM slice 6, canal A)
+#define LED_PIN_G 11    // LED Verde (PWM slice 5, canal B)
+
+// Slice PWM usado apenas como temporizador do DMA (GPIO 14/15 estão com o I2C, sem saída PWM)
+#define STATUS_LED_PACE_SLICE 7
+
+// Estados do sistema sinalizados pelo LED
+typedef enum {
+    SYSTEM_IDLE = 0,      // Sem atividade no barramento
+    SYSTEM_BUSY,          // Transferência I2C para o display em andamento (transitório, só sobre SYSTEM_IDLE)
+    SYSTEM_UART_OVERFLOW, // Dados perdidos na UART (overrun), mantido até status_led_clear_state
+    SYSTEM_STATE_COUNT
+} system_state_t;
+
+void status_led_init(void);
+void status_led_play(const status_led_effect_t *effect);
+void status_led_off(void);
+void status_led_map_state(system_state_t state, const status_led_effect_t *effect);
+void status_led_show_state(system_state_t state);
+void status_led_restore(void);
+void status_led_clear_state(system_state_t state);
+void status_led_update_clkdiv(void);
+
+#endif // STATUS_LED_H
@@ -0,0 +1,116 @@
+#include "status_led_wave.h"
+
+// Correção gama 2.2: nível de 8 bits -> ciclo de trabalho de 16 bits
+static const uint16_t gamma_table[256] = {
+        0,     0,     2,     4,     7,    11,    17,    24,
+       32,    42,    53,    65,    79,    94,   111,   129,
+      148,   169,   192,   216,   242,   270,   299,   330,
+      362,   396,   432,   469,   508,   549,   591,   635,
+      681,   729,   779,   830,   883,   938,   995,  1053,
+     1113,  1175,  1239,  1305,  1373,  1443,  1514,  1587,
+     1663,  1740,  1819,  1900,  1983,  2068,  2155,  2243,
+     2334,  2427,  2521,  2618,  2717,  2817,  2920,  3024,
+     3131,  3240,  3350,  3463,  3578,  3694,  3813,  3934,
+     4057,  4182,  4309,  4438,  4570,  4703,  4838,  4976,
+     5115,  5257,  5401,  5547,  5695,  5845,  5998,  6152,
+     6309,  6468,  6629,  6792,  6957,  7124,  7294,  7466,
+     7640,  7816,  7994,  8175,  8358,  8543,  8730,  8919,
+     9111,  9305,  9501,  9699,  9900, 10102, 10307, 10515,
+    10724, 10936, 11150, 11366, 11585, 11806, 12029, 12254,
+    12482, 12712, 12944, 13179, 13416, 13655, 13896, 14140,
+    14386, 14635, 14885, 15138, 15394, 15652, 15912, 16174,
+    16439, 16706, 16975, 17247, 17521, 17798, 18077, 18358,
+    18642, 18928, 19216, 19507, 19800, 20095, 20393, 20694,
+    20996, 21301, 21609, 21919, 22231, 22546, 22863, 23182,
+    23504, 23829, 24156, 24485, 24817, 25151, 25487, 25826,
+    26168, 26512, 26858, 27207, 27558, 27912, 28268, 28627,
+    28988, 29351, 29717, 30086, 30457, 30830, 31206, 31585,
+    31966, 32349, 32735, 33124, 33514, 33908, 34304, 34702,
+    35103, 35507, 35913, 36321, 36732, 37146, 37562, 37981,
+    38402, 38825, 39252, 39680, 40112, 40546, 40982, 41421,
+    41862, 42306, 42753, 43202, 43654, 44108, 44565, 45025,
+    45487, 45951, 46418, 46888, 47360, 47835, 48313, 48793,
+    49275, 49761, 50249, 50739, 51232, 51728, 52226, 52727,
+    53230, 53736, 54245, 54756, 55270, 55787, 56306, 56828,
+    57352, 57879, 58409, 58941, 59476, 60014, 60554, 61097,
+    61642, 62190, 62741, 63295, 63851, 64410, 64971, 65535
+};
+
+// Mapeamento fixo do RP2040: o GPIO n está no slice (n / 2) % 8, canal A se n for par
+// (o mesmo resultado de pwm_gpio_to_slice_num e pwm_gpio_to_channel)
+void status_led_layout_init(status_led_layout_t *layout, const unsigned pins[3]) {
+    layout->slice_count = 0;
+    for (unsigned c = 0; c < 3; c++) {
+        unsigned slice = (pins[c] >> 1) & 7;
+        unsigned s = 0;
+        while (s < layout->slice_count && layout->slices[s] != slice) {
+            s++;
+        }
+        if (s == layout->slice_count) { // Primeiro pino deste slice
+            layout->slices[layout->slice_count++] = slice;
+        }
+        layout->pin_slice[c] = s;
+        layout->pin_shift[c] = (pins[c] & 1) ? 16 : 0;
+    }
+}
+
+uint16_t status_led_gamma(uint8_t level) {
+    return gamma_table[level];
+}
+
+// Calcula o ciclo de trabalho R, G, B da amostra index (0 a STATUS_LED_TABLE_LEN - 1) de um efeito
+// A envoltória de brilho é aplicada antes da correção gama, assim a mistura de cores e o
+// brilho percebido variam de forma uniforme
+void status_led_waveform(const status_led_effect_t *effect, unsigned index, uint16_t duty[3]) {
+    const unsigned half = STATUS_LED_TABLE_LEN / 2;
+    unsigned envelope = 255;
+
+    if (effect->pattern == STATUS_LED_BREATHE) {
+        unsigned t = index < half ? index : STATUS_LED_TABLE_LEN - index; // Triângulo 0..half
+        unsigned x = t * 256 / half;                                     // 0..256
+        // Suavização (smoothstep) escalada para 0..255: só a amostra central atinge o máximo
+        // (o produto chega a 256^3 * 255, abaixo de 2^32)
+        envelope = x * x * (768 - 2 * x) * 255 / (65536u * 256);
+    } else if (effect->pattern == STATUS_LED_BLINK) {
+        envelope = index < half ? 255 : 0;
+    }
+
+    const uint8_t color[3] = {effect->r, effect->g, effect->b};
+    for (unsigned c = 0; c < 3; c++) {
+        duty[c] = gamma_table[color[c] * envelope / 255];
+    }
+}
+
+// Calcula a cadência de STATUS_LED_TABLE_LEN amostras por período para um clk_sys
+// Períodos acima de STATUS_LED_MAX_PERIOD_MS são limitados, em vez de o divisor saturar
+// e o padrão ser reproduzido mais rápido que o pedido
+void status_led_pace(uint32_t clk_hz, uint16_t period_ms, status_led_pace_t *pace) {
+    if (period_ms > STATUS_LED_MAX_PERIOD_MS) {
+        period_ms = STATUS_LED_MAX_PERIOD_MS;
+    }
+    uint64_t cycles = (uint64_t)clk_hz * period_ms / (1000u * STATUS_LED_TABLE_LEN); // Ciclos por amostra
+    uint64_t div = (cycles + 65535) / 65536; // Menor divisor inteiro que mantém wrap em 16 bits
+    if (div < 1) div = 1;
+    if (div > 255) div = 255; // Só com clk_sys acima de 142 MHz no período máximo
+    uint64_t wrap = cycles / div;
+    if (wrap < 1) wrap = 1;
+    if (wrap > 65536) wrap = 65536;
+
+    pace->div = (uint8_t)div;
+    pace->wrap = (uint32_t)wrap;
+}
+
+// Gera as tabelas de um efeito, uma por slice da distribuição (mesma ordem de layout->slices)
+void status_led_pack(const status_led_layout_t *layout, const status_led_effect_t *effect,
+                     uint32_t tables[][STATUS_LED_TABLE_LEN]) {
+    uint16_t duty[3];
+    for (unsigned i = 0; i < STATUS_LED_TABLE_LEN; i++) {
+        status_led_waveform(effect, i, duty);
+        for (unsigned s = 0; s < layout->slice_count; s++) {
+            tables[s][i] = 0;
+        }
+        for (unsigned c = 0; c < 3; c++) {
+            tables[layout->pin_slice[c]][i] |= (uint32_t)duty[c] << layout->pin_shift[c];
+        }
+    }
+}
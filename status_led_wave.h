@@ -0,0 +1,54 @@
+#ifndef STATUS_LED_WAVE_H
+#define STATUS_LED_WAVE_H
+
+// Efeitos do LED RGB, correção gama e geração das tabelas reproduzidas pelo DMA.
+// Não depende do Pico SDK, assim também é compilado nos testes no host.
+#include <stdint.h>
+
+// Amostras por período de um padrão; cada tabela ocupa 1 KB e é percorrida em anel pelo DMA
+#define STATUS_LED_TABLE_BITS 8
+#define STATUS_LED_TABLE_LEN (1u << STATUS_LED_TABLE_BITS)
+
+// Maior período de um padrão; valores acima são limitados a ele. O slice de temporização
+// conta no máximo 255 (divisor inteiro) * 65536 (wrap) ciclos por amostra, o que cobre
+// 30 s com clk_sys até 142 MHz (125 MHz no estado ativo, 24 MHz no sono)
+#define STATUS_LED_MAX_PERIOD_MS 30000
+
+// Padrões de exibição
+typedef enum {
+    STATUS_LED_SOLID = 0, // Cor fixa, sem DMA
+    STATUS_LED_BREATHE,   // Respiração suave entre apagado e a cor
+    STATUS_LED_BLINK      // Pisca: metade do período ligado, metade desligado
+} status_led_pattern_t;
+
+// Efeito completo: cor (8 bits por canal, antes da correção gama), padrão e período
+typedef struct {
+    uint8_t r, g, b;
+    status_led_pattern_t pattern;
+    uint16_t period_ms; // Até STATUS_LED_MAX_PERIOD_MS; 0 exibe a cor fixa
+} status_led_effect_t;
+
+// Divisor e wrap do slice de temporização: um pedido de DMA a cada div * wrap ciclos de clk_sys
+typedef struct {
+    uint8_t div;   // 1..255
+    uint32_t wrap; // 1..65536
+} status_led_pace_t;
+
+// Distribuição dos pinos R, G, B nos slices PWM
+// Cada slice usado recebe uma tabela de palavras de 32 bits (canal A nos 16 bits baixos,
+// canal B nos altos), pois escritas de 16 bits no registrador CC afetariam os dois canais
+typedef struct {
+    unsigned slices[3];     // Slices PWM distintos usados pelos pinos
+    unsigned slice_count;
+    unsigned pin_slice[3];  // Índice em slices[] de cada pino
+    unsigned pin_shift[3];  // 0 para canal A, 16 para canal B
+} status_led_layout_t;
+
+void status_led_layout_init(status_led_layout_t *layout, const unsigned pins[3]);
+uint16_t status_led_gamma(uint8_t level);
+void status_led_waveform(const status_led_effect_t *effect, unsigned index, uint16_t duty[3]);
+void status_led_pace(uint32_t clk_hz, uint16_t period_ms, status_led_pace_t *pace);
+void status_led_pack(const status_led_layout_t *layout, const status_led_effect_t *effect,
+                     uint32_t tables[][STATUS_LED_TABLE_LEN]);
+
+#endif // STATUS_LED_WAVE_H
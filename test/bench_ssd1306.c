@@ -0,0 +1,96 @@
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "test_util.h"
+#include "ssd1306_legacy.h"
+
+// Compara as primitivas atuais com as anteriores (legacy_*) em cargas dentro da tela:
+// a saída precisa ser idêntica e o tempo de cada versão é impresso
+// Uso: bench_ssd1306 [repetições]
+
+typedef void (*workload_fn)(ssd1306_t *ssd);
+
+static const char *const text = "UART I2C Explorer 0123456789 abcdefghij";
+
+static void current_fill(ssd1306_t *ssd) { ssd1306_fill(ssd, true); ssd1306_fill(ssd, false); }
+static void legacy_fill_both(ssd1306_t *ssd) { legacy_fill(ssd, true); legacy_fill(ssd, false); }
+
+static void current_text(ssd1306_t *ssd) { ssd1306_draw_string(ssd, text, 3, 2); }
+static void legacy_text(ssd1306_t *ssd) { legacy_draw_string(ssd, text, 3, 2); }
+
+static void current_rects(ssd1306_t *ssd) {
+    ssd1306_rect(ssd, 3, 3, 122, 60, true, false);
+    ssd1306_rect(ssd, 10, 20, 50, 30, true, true);
+    ssd1306_rect(ssd, 13, 23, 44, 24, false, true);
+}
+static void legacy_rects(ssd1306_t *ssd) {
+    legacy_rect(ssd, 3, 3, 122, 60, true, false);
+    legacy_rect(ssd, 10, 20, 50, 30, true, true);
+    legacy_rect(ssd, 13, 23, 44, 24, false, true);
+}
+
+static void current_lines(ssd1306_t *ssd) {
+    for (uint8_t i = 0; i < 64; i += 4) {
+        ssd1306_line(ssd, 0, i, 127, 63 - i, true);
+        ssd1306_hline(ssd, 0, 127, i, i & 4);
+        ssd1306_vline(ssd, 2 * i, 0, 63, i & 4);
+    }
+}
+static void legacy_lines(ssd1306_t *ssd) {
+    for (uint8_t i = 0; i < 64; i += 4) {
+        legacy_line(ssd, 0, i, 127, 63 - i, true);
+        legacy_hline(ssd, 0, 127, i, i & 4);
+        legacy_vline(ssd, 2 * i, 0, 63, i & 4);
+    }
+}
+
+typedef struct {
+    const char *name;
+    workload_fn current;
+    workload_fn legacy;
+} workload_t;
+
+static const workload_t workloads[] = {
+    {"fill", current_fill, legacy_fill_both},
+    {"draw_string", current_text, legacy_text},
+    {"rect", current_rects, legacy_rects},
+    {"line/hline/vline", current_lines, legacy_lines},
+};
+
+static double run(ssd1306_t *ssd, workload_fn fn, long repeat) {
+    clock_t start = clock();
+    for (long i = 0; i < repeat; i++)
+        fn(ssd);
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char **argv) {
+    long repeat = argc > 1 ? atol(argv[1]) : 20000;
+    ssd1306_t current, legacy;
+    ssd1306_init(&current, WIDTH, HEIGHT, false, 0x3C, NULL);
+    ssd1306_init(&legacy, WIDTH, HEIGHT, false, 0x3C, NULL);
+
+    printf("%-18s %12s %12s %8s\n", "carga", "anterior (s)", "atual (s)", "ganho");
+    for (size_t i = 0; i < sizeof(workloads) / sizeof(workloads[0]); i++) {
+        const workload_t *w = &workloads[i];
+
+        // Mesma saída a partir do mesmo buffer inicial
+        ssd1306_fill(&current, false);
+        ssd1306_fill(&legacy, false);
+        w->current(&current);
+        w->legacy(&legacy);
+        if (memcmp(current.ram_buffer, legacy.ram_buffer, current.bufsize) != 0) {
+            printf("%s: saída diferente da versão anterior\n", w->name);
+            test_failures++;
+        }
+
+        double t_legacy = run(&legacy, w->legacy, repeat);
+        double t_current = run(&current, w->current, repeat);
+        printf("%-18s %12.3f %12.3f %7.1fx\n", w->name, t_legacy, t_current,
+               t_current > 0 ? t_legacy / t_current : 0.0);
+    }
+
+    free(current.ram_buffer);
+    free(legacy.ram_buffer);
+    return TEST_RESULT();
+}
@@ -0,0 +1,121 @@
+// Primitivas de desenho da versão anterior de inc/ssd1306.c, renomeadas para legacy_*
+// Usadas apenas como referência: equivalência de saída e comparação de tempo em bench_ssd1306.c
+// Mantidas como estavam, sem recorte: as coordenadas precisam estar dentro da tela
+#include "ssd1306_legacy.h"
+#include "inc/font.h"
+
+void legacy_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
+  uint16_t index = (y >> 3) + (x << 3) + 1;
+  uint8_t pixel = (y & 0b111);
+  if (value)
+    ssd->ram_buffer[index] |= (1 << pixel);
+  else
+    ssd->ram_buffer[index] &= ~(1 << pixel);
+}
+
+void legacy_fill(ssd1306_t *ssd, bool value) {
+    // Itera por todas as posições do display
+    for (uint8_t y = 0; y < ssd->height; ++y) {
+        for (uint8_t x = 0; x < ssd->width; ++x) {
+            legacy_pixel(ssd, x, y, value);
+        }
+    }
+}
+
+void legacy_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill) {
+  for (uint8_t x = left; x < left + width; ++x) {
+    legacy_pixel(ssd, x, top, value);
+    legacy_pixel(ssd, x, top + height - 1, value);
+  }
+  for (uint8_t y = top; y < top + height; ++y) {
+    legacy_pixel(ssd, left, y, value);
+    legacy_pixel(ssd, left + width - 1, y, value);
+  }
+
+  if (fill) {
+    for (uint8_t x = left + 1; x < left + width - 1; ++x) {
+      for (uint8_t y = top + 1; y < top + height - 1; ++y) {
+        legacy_pixel(ssd, x, y, value);
+      }
+    }
+  }
+}
+
+void legacy_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value) {
+    int dx = abs(x1 - x0);
+    int dy = abs(y1 - y0);
+
+    int sx = (x0 < x1) ? 1 : -1;
+    int sy = (y0 < y1) ? 1 : -1;
+
+    int err = dx - dy;
+
+    while (true) {
+        legacy_pixel(ssd, x0, y0, value); // Desenha o pixel atual
+
+        if (x0 == x1 && y0 == y1) break; // Termina quando alcança o ponto final
+
+        int e2 = err * 2;
+
+        if (e2 > -dy) {
+            err -= dy;
+            x0 += sx;
+        }
+
+        if (e2 < dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+void legacy_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value) {
+  for (uint8_t x = x0; x <= x1; ++x)
+    legacy_pixel(ssd, x, y, value);
+}
+
+void legacy_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value) {
+  for (uint8_t y = y0; y <= y1; ++y)
+    legacy_pixel(ssd, x, y, value);
+}
+
+void legacy_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
+{
+    uint16_t index = 0;
+
+    if (c >= 'A' && c <= 'Z') {
+        index = (c - 'A' + 11) * 8; // Índice para letras maiúsculas
+    } else if (c >= '0' && c <= '9') {
+        index = (c - '0' + 1) * 8; // Índice para números
+    } else if (c >= 'a' && c <= 'z') {
+        index = (c - 'a' + 37) * 8; // Índice para letras minúsculas
+    } else {
+        return; // Caractere não suportado
+    }
+
+    for (uint8_t i = 0; i < 8; ++i) {
+        uint8_t line = font[index + i];
+        for (uint8_t j = 0; j < 8; ++j) {
+            legacy_pixel(ssd, x + i, y + j, line & (1 << j));
+        }
+    }
+}
+
+// Função para desenhar uma string
+void legacy_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y)
+{
+  while (*str)
+  {
+    legacy_draw_char(ssd, *str++, x, y);
+    x += 8;
+    if (x + 8 >= ssd->width)
+    {
+      x = 0;
+      y += 8;
+    }
+    if (y + 8 >= ssd->height)
+    {
+      break;
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#ifndef SSD1306_LEGACY_H
+#define SSD1306_LEGACY_H
+
+#include "inc/ssd1306.h"
+
+void legacy_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value);
+void legacy_fill(ssd1306_t *ssd, bool value);
+void legacy_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill);
+void legacy_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value);
+void legacy_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value);
+void legacy_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value);
+void legacy_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y);
+void legacy_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
+
+#endif // SSD1306_LEGACY_H
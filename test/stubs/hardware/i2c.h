@@ -0,0 +1,11 @@
+#ifndef TEST_STUB_HARDWARE_I2C_H
+#define TEST_STUB_HARDWARE_I2C_H
+
+#include "pico/stdlib.h"
+
+typedef struct i2c_inst i2c_inst_t;
+
+// Implementado em i2c_stub.c: descarta os dados, os testes só verificam ram_buffer
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
+
+#endif // TEST_STUB_HARDWARE_I2C_H
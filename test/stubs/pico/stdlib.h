@@ -0,0 +1,11 @@
+#ifndef TEST_STUB_PICO_STDLIB_H
+#define TEST_STUB_PICO_STDLIB_H
+
+// Substituto mínimo do Pico SDK para compilar inc/ssd1306.c no host
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef unsigned int uint;
+
+#endif // TEST_STUB_PICO_STDLIB_H
@@ -0,0 +1,145 @@
+#include "test_util.h"
+#include "led_matrix_map.h"
+
+static led_matrix_config_t make_config(uint8_t tw, uint8_t th, uint8_t tx, uint8_t ty,
+                                       led_layout_t layout, led_layout_t tile_layout) {
+    led_matrix_config_t c = {0};
+    c.tile_width = tw;
+    c.tile_height = th;
+    c.tiles_x = tx;
+    c.tiles_y = ty;
+    c.layout = layout;
+    c.tile_layout = tile_layout;
+    c.strip_count = 1;
+    return c;
+}
+
+// Configuração padrão da BitDogLab: 5x5 progressivo, índice = linha * 5 + coluna
+static void test_progressive(void) {
+    led_matrix_config_t c = make_config(5, 5, 1, 1, LED_LAYOUT_PROGRESSIVE, LED_LAYOUT_PROGRESSIVE);
+    for (unsigned y = 0; y < 5; y++) {
+        for (unsigned x = 0; x < 5; x++) {
+            CHECK_EQ(led_matrix_map_xy(&c, x, y), y * 5 + x);
+        }
+    }
+}
+
+// Linhas ímpares invertidas dentro da matriz
+static void test_serpentine(void) {
+    led_matrix_config_t c = make_config(4, 3, 1, 1, LED_LAYOUT_SERPENTINE, LED_LAYOUT_PROGRESSIVE);
+    CHECK_EQ(led_matrix_map_xy(&c, 0, 0), 0);
+    CHECK_EQ(led_matrix_map_xy(&c, 3, 0), 3);
+    CHECK_EQ(led_matrix_map_xy(&c, 3, 1), 4);
+    CHECK_EQ(led_matrix_map_xy(&c, 0, 1), 7);
+    CHECK_EQ(led_matrix_map_xy(&c, 0, 2), 8);
+    CHECK_EQ(led_matrix_map_xy(&c, 3, 2), 11);
+}
+
+// Matrizes encadeadas: 2x2 matrizes de 3x2 LEDs, cadeia em serpentina entre matrizes
+static void test_serpentine_tiles(void) {
+    led_matrix_config_t c = make_config(3, 2, 2, 2, LED_LAYOUT_PROGRESSIVE, LED_LAYOUT_SERPENTINE);
+    CHECK_EQ(led_matrix_map_xy(&c, 0, 0), 0);      // Matriz 0
+    CHECK_EQ(led_matrix_map_xy(&c, 3, 0), 6);      // Matriz 1 (à direita)
+    CHECK_EQ(led_matrix_map_xy(&c, 3, 2), 12);     // Segunda linha começa pela direita: matriz 2
+    CHECK_EQ(led_matrix_map_xy(&c, 0, 2), 18);     // Matriz 3 (à esquerda)
+    CHECK_EQ(led_matrix_map_xy(&c, 5, 3), 12 + 5); // Último LED da matriz 2
+
+    // Serpentina nos dois níveis
+    c.layout = LED_LAYOUT_SERPENTINE;
+    CHECK_EQ(led_matrix_map_xy(&c, 0, 1), 5);
+    CHECK_EQ(led_matrix_map_xy(&c, 2, 3), 18 + 3);    // Matriz 3, linha 1 invertida: coluna 2 vira 0
+
+    // Todo índice da cadeia é atingido exatamente uma vez
+    int seen[24] = {0};
+    for (unsigned y = 0; y < 4; y++) {
+        for (unsigned x = 0; x < 6; x++) {
+            uint32_t i = led_matrix_map_xy(&c, x, y);
+            CHECK(i < 24);
+            if (i < 24) {
+                seen[i]++;
+            }
+        }
+    }
+    for (int i = 0; i < 24; i++) {
+        CHECK_EQ(seen[i], 1);
+    }
+}
+
+static void test_out_of_range(void) {
+    led_matrix_config_t c = make_config(5, 5, 2, 1, LED_LAYOUT_PROGRESSIVE, LED_LAYOUT_PROGRESSIVE);
+    CHECK_EQ(led_matrix_map_xy(&c, 10, 0), LED_MATRIX_INVALID_INDEX);
+    CHECK_EQ(led_matrix_map_xy(&c, 0, 5), LED_MATRIX_INVALID_INDEX);
+    CHECK_EQ(led_matrix_map_xy(&c, 0xFFFFFFFFu, 0), LED_MATRIX_INVALID_INDEX);
+    CHECK(led_matrix_map_xy(&c, 9, 4) != LED_MATRIX_INVALID_INDEX);
+
+    led_matrix_config_t empty = make_config(0, 5, 1, 1, LED_LAYOUT_PROGRESSIVE, LED_LAYOUT_PROGRESSIVE);
+    CHECK_EQ(led_matrix_map_xy(&empty, 0, 0), LED_MATRIX_INVALID_INDEX);
+}
+
+// Segmentos sempre começam no início de uma matriz
+static void test_strip_split(void) {
+    led_matrix_config_t c = make_config(5, 5, 1, 1, LED_LAYOUT_PROGRESSIVE, LED_LAYOUT_PROGRESSIVE);
+    CHECK_EQ(led_matrix_strip_len(&c), 25);
+
+    // 3 matrizes 5x5 em 2 pinos: 2 matrizes + 1 matriz (e não 38 + 37 LEDs)
+    c = make_config(5, 5, 3, 1, LED_LAYOUT_PROGRESSIVE, LED_LAYOUT_PROGRESSIVE);
+    c.strip_count = 2;
+    CHECK_EQ(led_matrix_strip_len(&c), 50);
+
+    // 4x4 matrizes 8x8 em 8 pinos: 2 matrizes por pino
+    c = make_config(8, 8, 4, 4, LED_LAYOUT_SERPENTINE, LED_LAYOUT_SERPENTINE);
+    c.strip_count = 8;
+    CHECK_EQ(led_matrix_strip_len(&c), 128);
+
+    // Todo limite de segmento cai em um limite de matriz, para qualquer número de pinos
+    int misaligned = 0;
+    for (uint8_t tiles = 1; tiles <= 12; tiles++) {
+        for (uint8_t strips = 1; strips <= LED_MATRIX_MAX_STRIPS; strips++) {
+            c = make_config(5, 3, tiles, 1, LED_LAYOUT_PROGRESSIVE, LED_LAYOUT_PROGRESSIVE);
+            c.strip_count = strips;
+            uint32_t len = led_matrix_strip_len(&c);
+            if (len == 0) {
+                continue;
+            }
+            // Nenhum segmento vazio e todos os LEDs cobertos
+            if (len % 15 != 0 || (strips - 1) * len >= tiles * 15u || strips * len < tiles * 15u) {
+                misaligned++;
+            }
+        }
+    }
+    CHECK_EQ(misaligned, 0);
+
+    // Configurações que deixariam um pino sem matrizes
+    c = make_config(5, 5, 4, 1, LED_LAYOUT_PROGRESSIVE, LED_LAYOUT_PROGRESSIVE);
+    c.strip_count = 3;
+    CHECK_EQ(led_matrix_strip_len(&c), 0);
+    c = make_config(5, 5, 1, 1, LED_LAYOUT_PROGRESSIVE, LED_LAYOUT_PROGRESSIVE);
+    c.strip_count = 2;
+    CHECK_EQ(led_matrix_strip_len(&c), 0);
+    c.strip_count = 0;
+    CHECK_EQ(led_matrix_strip_len(&c), 0);
+    c.strip_count = LED_MATRIX_MAX_STRIPS + 1;
+    CHECK_EQ(led_matrix_strip_len(&c), 0);
+    c = make_config(0, 5, 1, 1, LED_LAYOUT_PROGRESSIVE, LED_LAYOUT_PROGRESSIVE);
+    CHECK_EQ(led_matrix_strip_len(&c), 0);
+}
+
+// Valores da tabela de temporização do README (LEDs do maior segmento)
+static void test_frame_time(void) {
+    CHECK_EQ(led_matrix_frame_time_us(25), 1050);
+    CHECK_EQ(led_matrix_frame_time_us(256), 7980);
+    CHECK_EQ(led_matrix_frame_time_us(64), 2220);
+    CHECK_EQ(led_matrix_frame_time_us(1024), 31020);
+    CHECK_EQ(led_matrix_frame_time_us(128), 4140);
+    CHECK_EQ(1000000 / led_matrix_frame_time_us(128), 241);
+}
+
+int main(void) {
+    test_progressive();
+    test_serpentine();
+    test_serpentine_tiles();
+    test_out_of_range();
+    test_strip_split();
+    test_frame_time();
+    return TEST_RESULT();
+}
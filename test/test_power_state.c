@@ -0,0 +1,63 @@
+#include <string.h>
+#include "test_util.h"
+#include "power_state.h"
+
+static const power_timeouts_t timeouts = {
+    .dim_ms = 15000,
+    .blank_ms = 60000,
+    .sleep_ms = 120000,
+};
+
+// Cada limite é inclusivo: o estado muda exatamente no tempo configurado
+static void test_thresholds(void) {
+    CHECK_EQ(power_state_for_idle(&timeouts, 0), POWER_ACTIVE);
+    CHECK_EQ(power_state_for_idle(&timeouts, 14999), POWER_ACTIVE);
+    CHECK_EQ(power_state_for_idle(&timeouts, 15000), POWER_DIM);
+    CHECK_EQ(power_state_for_idle(&timeouts, 59999), POWER_DIM);
+    CHECK_EQ(power_state_for_idle(&timeouts, 60000), POWER_BLANK);
+    CHECK_EQ(power_state_for_idle(&timeouts, 119999), POWER_BLANK);
+    CHECK_EQ(power_state_for_idle(&timeouts, 120000), POWER_SLEEP);
+    CHECK_EQ(power_state_for_idle(&timeouts, 0xFFFFFFFFu), POWER_SLEEP);
+}
+
+// Limite 0 desativa apenas aquele estado; os demais continuam valendo
+static void test_disabled_limits(void) {
+    power_timeouts_t none = {0, 0, 0};
+    CHECK_EQ(power_state_for_idle(&none, 0xFFFFFFFFu), POWER_ACTIVE);
+
+    power_timeouts_t no_dim = timeouts;
+    no_dim.dim_ms = 0;
+    CHECK_EQ(power_state_for_idle(&no_dim, 30000), POWER_ACTIVE);
+    CHECK_EQ(power_state_for_idle(&no_dim, 60000), POWER_BLANK);
+
+    power_timeouts_t no_sleep = timeouts;
+    no_sleep.sleep_ms = 0;
+    CHECK_EQ(power_state_for_idle(&no_sleep, 0xFFFFFFFFu), POWER_BLANK);
+
+    power_timeouts_t only_sleep = {0, 0, 5000};
+    CHECK_EQ(power_state_for_idle(&only_sleep, 4999), POWER_ACTIVE);
+    CHECK_EQ(power_state_for_idle(&only_sleep, 5000), POWER_SLEEP);
+}
+
+// to_ms_since_boot() truncado em 32 bits dá a volta a cada ~49,7 dias
+static void test_wrap(void) {
+    CHECK_EQ(power_idle_ms(1000, 400), 600);
+    CHECK_EQ(power_idle_ms(100, 0xFFFFFF00u), 356);
+    CHECK_EQ(power_idle_ms(0, 0xFFFFFFFFu), 1);
+    CHECK_EQ(power_state_for_idle(&timeouts, power_idle_ms(10000, 0xFFFF0000u)), POWER_BLANK); // 75536 ms
+    CHECK_EQ(power_state_for_idle(&timeouts, power_idle_ms(5, 0xFFFFFFF0u)), POWER_ACTIVE);
+}
+
+static void test_names(void) {
+    CHECK(strcmp(power_state_name(POWER_ACTIVE), "ativo") == 0);
+    CHECK(strcmp(power_state_name(POWER_SLEEP), "sono") == 0);
+    CHECK(strcmp(power_state_name((power_state_t)42), "?") == 0);
+}
+
+int main(void) {
+    test_thresholds();
+    test_disabled_limits();
+    test_wrap();
+    test_names();
+    return TEST_RESULT();
+}
@@ -0,0 +1,294 @@
+#include <stdlib.h>
+#include <string.h>
+#include "test_util.h"
+#include "inc/ssd1306.h"
+
+// Bytes de guarda antes e depois de ram_buffer: qualquer escrita fora da tela os altera
+#define GUARD_LEN 64
+#define GUARD_BYTE 0xA5
+#define FUZZ_ITERATIONS 20000
+
+static uint8_t *guarded;   // Alocação completa: guarda + buffer + guarda
+static bool ref[HEIGHT][WIDTH]; // Modelo de referência, pixel a pixel
+static uint32_t rng_state = 0x12345678;
+
+// xorshift32: sequência determinística, a mesma em todas as execuções
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Metade das coordenadas perto da tela, metade em toda a faixa de int16_t
+static int16_t random_coord(void) {
+    if (next_random() & 1)
+        return (int16_t)((int)(next_random() % 224) - 48);
+    return (int16_t)next_random();
+}
+
+static void display_init(ssd1306_t *ssd) {
+    ssd1306_init(ssd, WIDTH, HEIGHT, false, 0x3C, NULL);
+    free(ssd->ram_buffer);
+    guarded = malloc(ssd->bufsize + 2 * GUARD_LEN);
+    memset(guarded, GUARD_BYTE, ssd->bufsize + 2 * GUARD_LEN);
+    ssd->ram_buffer = guarded + GUARD_LEN;
+    ssd->ram_buffer[0] = 0x40;
+}
+
+// Limpa o buffer e o modelo de referência
+static void clear(ssd1306_t *ssd) {
+    ssd1306_fill(ssd, false);
+    memset(ref, 0, sizeof(ref));
+}
+
+static bool guards_intact(const ssd1306_t *ssd) {
+    for (size_t i = 0; i < GUARD_LEN; i++) {
+        if (guarded[i] != GUARD_BYTE || guarded[GUARD_LEN + ssd->bufsize + i] != GUARD_BYTE)
+            return false;
+    }
+    return ssd->ram_buffer[0] == 0x40; // Byte de controle enviado antes dos dados
+}
+
+static bool get_pixel(const ssd1306_t *ssd, int x, int y) {
+    return (ssd->ram_buffer[1 + x * ssd->pages + (y >> 3)] >> (y & 7)) & 1;
+}
+
+static int count_pixels(const ssd1306_t *ssd) {
+    int n = 0;
+    for (int y = 0; y < HEIGHT; y++)
+        for (int x = 0; x < WIDTH; x++)
+            n += get_pixel(ssd, x, y);
+    return n;
+}
+
+static bool matches_ref(const ssd1306_t *ssd) {
+    for (int y = 0; y < HEIGHT; y++)
+        for (int x = 0; x < WIDTH; x++)
+            if (get_pixel(ssd, x, y) != ref[y][x])
+                return false;
+    return true;
+}
+
+static void ref_pixel(int x, int y, bool value) {
+    if (x >= 0 && y >= 0 && x < WIDTH && y < HEIGHT)
+        ref[y][x] = value;
+}
+
+// Retângulo [x0, x1] x [y0, y1] no modelo, percorrendo apenas a parte visível
+static void ref_fill(int x0, int y0, int x1, int y1, bool value) {
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= WIDTH) x1 = WIDTH - 1;
+    if (y1 >= HEIGHT) y1 = HEIGHT - 1;
+    for (int y = y0; y <= y1; y++)
+        for (int x = x0; x <= x1; x++)
+            ref[y][x] = value;
+}
+
+static void ref_rect(int top, int left, int width, int height, bool value, bool fill) {
+    if (width <= 0 || height <= 0)
+        return;
+    int right = left + width - 1, bottom = top + height - 1;
+    if (fill) {
+        ref_fill(left, top, right, bottom, value);
+        return;
+    }
+    ref_fill(left, top, right, top, value);
+    ref_fill(left, bottom, right, bottom, value);
+    ref_fill(left, top, left, bottom, value);
+    ref_fill(right, top, right, bottom, value);
+}
+
+// Linha de Bresenham completa, sem recorte: cada pixel é descartado individualmente
+// (mesmo laço da versão anterior de ssd1306_line, para segmentos dentro da tela)
+static void ref_line(int x0, int y0, int x1, int y1, bool value) {
+    int dx = abs(x1 - x0), dy = abs(y1 - y0);
+    int sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+    int err = dx - dy;
+    while (true) {
+        ref_pixel(x0, y0, value);
+        if (x0 == x1 && y0 == y1)
+            break;
+        int e2 = err * 2;
+        if (e2 > -dy) {
+            err -= dy;
+            x0 += sx;
+        }
+        if (e2 < dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+static void ref_blit(const uint8_t *bitmap, int x, int y, int width, int height) {
+    int stride = (height + 7) / 8;
+    for (int i = 0; i < width; i++)
+        for (int j = 0; j < height; j++)
+            ref_pixel(x + i, y + j, (bitmap[i * stride + j / 8] >> (j & 7)) & 1);
+}
+
+// Sequência aleatória de primitivas; as que têm modelo são comparadas pixel a pixel,
+// as demais (círculos, retângulos arredondados, polígonos) verificam apenas as guardas
+static void test_random_primitives(ssd1306_t *ssd) {
+    clear(ssd);
+    int ref_failures = 0, guard_failures = 0;
+
+    for (int it = 0; it < FUZZ_ITERATIONS; it++) {
+        bool value = next_random() & 1;
+        bool fill = next_random() & 1;
+        bool has_ref = true;
+        int16_t a = random_coord(), b = random_coord(), c = random_coord(), d = random_coord();
+
+        switch (next_random() % 9) {
+            case 0:
+                ssd1306_pixel(ssd, a, b, value);
+                ref_pixel(a, b, value);
+                break;
+            case 1:
+                ssd1306_rect(ssd, a, b, c, d, value, fill);
+                ref_rect(a, b, c, d, value, fill);
+                break;
+            case 2:
+                ssd1306_hline(ssd, a, b, c, value);
+                ref_fill(a < b ? a : b, c, a < b ? b : a, c, value);
+                break;
+            case 3:
+                ssd1306_vline(ssd, a, b, c, value);
+                ref_fill(a, b < c ? b : c, a, b < c ? c : b, value);
+                break;
+            case 4: {
+                uint8_t bitmap[4 * 24];
+                uint8_t width = 1 + next_random() % 24;
+                uint8_t height = 1 + next_random() % 32;
+                for (size_t i = 0; i < sizeof(bitmap); i++)
+                    bitmap[i] = (uint8_t)next_random();
+                ssd1306_blit(ssd, bitmap, a, b, width, height);
+                ref_blit(bitmap, a, b, width, height);
+                break;
+            }
+            case 5:
+                ssd1306_line(ssd, a, b, c, d, value);
+                ref_line(a, b, c, d, value);
+                break;
+            case 6:
+                ssd1306_circle(ssd, a, b, (int16_t)(next_random() % 200), value, fill);
+                has_ref = false;
+                break;
+            case 7:
+                ssd1306_round_rect(ssd, a, b, c, d, (int16_t)(next_random() % 40), value, fill);
+                has_ref = false;
+                break;
+            default: {
+                ssd1306_point_t points[SSD1306_POLYGON_MAX_POINTS];
+                uint8_t count = 1 + next_random() % SSD1306_POLYGON_MAX_POINTS;
+                for (uint8_t i = 0; i < count; i++) {
+                    points[i].x = random_coord();
+                    points[i].y = random_coord();
+                }
+                ssd1306_polygon(ssd, points, count, value, fill);
+                has_ref = false;
+                break;
+            }
+        }
+
+        if (!guards_intact(ssd) && guard_failures++ == 0)
+            printf("iteração %d: escrita fora de ram_buffer\n", it);
+        if (has_ref) {
+            if (!matches_ref(ssd) && ref_failures++ == 0)
+                printf("iteração %d: buffer diferente do modelo de referência\n", it);
+        } else {
+            // Resincroniza o modelo com o resultado das primitivas sem referência
+            for (int y = 0; y < HEIGHT; y++)
+                for (int x = 0; x < WIDTH; x++)
+                    ref[y][x] = get_pixel(ssd, x, y);
+        }
+    }
+    CHECK_EQ(guard_failures, 0);
+    CHECK_EQ(ref_failures, 0);
+}
+
+// Regressão: com vértices nos extremos de int16_t, (y - yi) * (xj - xi) passava de 2^31
+// O triângulo cobre a metade da tela com x >= y (a aresta longa é a diagonal y = x)
+static void test_polygon_extreme_vertices(ssd1306_t *ssd) {
+    const ssd1306_point_t points[] = {{32767, 32767}, {-32768, -32768}, {32767, -32768}};
+
+    clear(ssd);
+    ssd1306_polygon(ssd, points, 3, true, true);
+    CHECK(guards_intact(ssd));
+    int wrong = 0;
+    for (int y = 0; y < HEIGHT; y++)
+        for (int x = 0; x < WIDTH; x++)
+            if (x != y && get_pixel(ssd, x, y) != (x > y))
+                wrong++;
+    CHECK_EQ(wrong, 0);
+    CHECK(get_pixel(ssd, 127, 0));
+    CHECK(!get_pixel(ssd, 0, 63));
+
+    // Só o contorno: a diagonal visível e a borda superior estão fora da tela
+    clear(ssd);
+    ssd1306_polygon(ssd, points, 3, true, false);
+    CHECK(guards_intact(ssd));
+    CHECK_EQ(count_pixels(ssd), HEIGHT);
+}
+
+// Recorte de linhas com extremos em toda a faixa de int16_t
+static void test_line_extreme_endpoints(ssd1306_t *ssd) {
+    clear(ssd);
+    ssd1306_line(ssd, -32768, -32768, 32767, 32767, true);
+    CHECK(guards_intact(ssd));
+    CHECK_EQ(count_pixels(ssd), HEIGHT);
+    for (int i = 0; i < HEIGHT; i++)
+        CHECK(get_pixel(ssd, i, i));
+
+    clear(ssd);
+    ssd1306_line(ssd, -32768, 5, 32767, 5, true);
+    CHECK_EQ(count_pixels(ssd), WIDTH);
+    ssd1306_line(ssd, 7, 32767, 7, -32768, false);
+    CHECK_EQ(count_pixels(ssd), WIDTH - 1);
+
+    // Totalmente fora da tela: nenhum pixel é escrito
+    clear(ssd);
+    ssd1306_line(ssd, -32768, 32767, 32767, -32768, true);
+    ssd1306_line(ssd, 32767, 32767, -32768, 32767, true);
+    CHECK(guards_intact(ssd));
+    CHECK_EQ(count_pixels(ssd), 0);
+}
+
+// Linhas parcialmente visíveis perto da tela: a parte recortada precisa coincidir pixel a
+// pixel com a linha sem recorte (o recorte por interseção arredondava o novo extremo)
+static void test_clipped_lines_match_unclipped(ssd1306_t *ssd) {
+    int differing = 0;
+    for (int i = 0; i < 20000; i++) {
+        int16_t x0 = (int16_t)((int)(next_random() % 600) - 236);
+        int16_t y0 = (int16_t)((int)(next_random() % 400) - 168);
+        int16_t x1 = (int16_t)((int)(next_random() % 600) - 236);
+        int16_t y1 = (int16_t)((int)(next_random() % 400) - 168);
+        clear(ssd);
+        ssd1306_line(ssd, x0, y0, x1, y1, true);
+        ref_line(x0, y0, x1, y1, true);
+        if (!matches_ref(ssd) && differing++ == 0)
+            printf("linha (%d,%d)-(%d,%d) diferente da linha sem recorte\n", x0, y0, x1, y1);
+    }
+    CHECK_EQ(differing, 0);
+
+    // Caso relatado na revisão: diferia em 46 pixels
+    clear(ssd);
+    ssd1306_line(ssd, 13, 53, 126, -141, true);
+    ref_line(13, 53, 126, -141, true);
+    CHECK(matches_ref(ssd));
+}
+
+int main(void) {
+    ssd1306_t ssd;
+    display_init(&ssd);
+
+    test_random_primitives(&ssd);
+    test_polygon_extreme_vertices(&ssd);
+    test_line_extreme_endpoints(&ssd);
+    test_clipped_lines_match_unclipped(&ssd);
+
+    free(guarded);
+    return TEST_RESULT();
+}
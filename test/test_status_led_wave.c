@@ -0,0 +1,159 @@
+#include "test_util.h"
+#include "status_led_wave.h"
+
+// Pinos da BitDogLab na ordem R, G, B (mesmos valores de status_led.h)
+static const unsigned pins[3] = {13, 11, 12};
+
+// Extremos exatos e curva estritamente crescente a partir do nível 2 (níveis 0 e 1 arredondam para 0)
+static void test_gamma(void) {
+    CHECK_EQ(status_led_gamma(0), 0);
+    CHECK_EQ(status_led_gamma(255), 65535);
+    int not_monotonic = 0;
+    for (unsigned level = 1; level < 256; level++) {
+        if (status_led_gamma(level) < status_led_gamma(level - 1))
+            not_monotonic++;
+        if (level >= 2 && status_led_gamma(level) == status_led_gamma(level - 1))
+            not_monotonic++;
+    }
+    CHECK_EQ(not_monotonic, 0);
+}
+
+// Cor fixa: todas as amostras iguais à cor corrigida
+static void test_solid(void) {
+    status_led_effect_t e = {255, 128, 0, STATUS_LED_SOLID, 0};
+    uint16_t duty[3];
+    status_led_waveform(&e, 77, duty);
+    CHECK_EQ(duty[0], 65535);
+    CHECK_EQ(duty[1], status_led_gamma(128));
+    CHECK_EQ(duty[2], 0);
+}
+
+// Respiração: apagado no início, máximo só no meio da tabela e simétrica em torno dele
+static void test_breathe(void) {
+    status_led_effect_t e = {255, 255, 255, STATUS_LED_BREATHE, 2000};
+    uint16_t duty[3], mirror[3];
+    unsigned peak = 0;
+    uint16_t max = 0;
+    for (unsigned i = 0; i < STATUS_LED_TABLE_LEN; i++) {
+        status_led_waveform(&e, i, duty);
+        if (duty[0] > max) {
+            max = duty[0];
+            peak = i;
+        }
+    }
+    CHECK_EQ(peak, STATUS_LED_TABLE_LEN / 2);
+    CHECK_EQ(max, 65535);
+
+    status_led_waveform(&e, 0, duty);
+    CHECK_EQ(duty[0], 0);
+
+    int asymmetric = 0;
+    for (unsigned i = 1; i < STATUS_LED_TABLE_LEN / 2; i++) {
+        status_led_waveform(&e, i, duty);
+        status_led_waveform(&e, STATUS_LED_TABLE_LEN - i, mirror);
+        if (duty[0] != mirror[0] || duty[1] != mirror[1] || duty[2] != mirror[2])
+            asymmetric++;
+    }
+    CHECK_EQ(asymmetric, 0);
+}
+
+// Pisca: primeira metade da tabela acesa, segunda metade apagada
+static void test_blink(void) {
+    status_led_effect_t e = {255, 0, 64, STATUS_LED_BLINK, 500};
+    uint16_t duty[3];
+    unsigned on = 0, off = 0;
+    for (unsigned i = 0; i < STATUS_LED_TABLE_LEN; i++) {
+        status_led_waveform(&e, i, duty);
+        if (duty[0] == 65535 && duty[2] == status_led_gamma(64))
+            on += i < STATUS_LED_TABLE_LEN / 2;
+        else if (duty[0] == 0 && duty[1] == 0 && duty[2] == 0)
+            off += i >= STATUS_LED_TABLE_LEN / 2;
+    }
+    CHECK_EQ(on, STATUS_LED_TABLE_LEN / 2);
+    CHECK_EQ(off, STATUS_LED_TABLE_LEN / 2);
+}
+
+// GPIO 13 (R) e 12 (B) dividem o slice 6 (B no canal A); GPIO 11 (G) é o canal B do slice 5
+static void test_layout(void) {
+    status_led_layout_t layout;
+    status_led_layout_init(&layout, pins);
+    CHECK_EQ(layout.slice_count, 2);
+    CHECK_EQ(layout.slices[layout.pin_slice[0]], 6);
+    CHECK_EQ(layout.slices[layout.pin_slice[1]], 5);
+    CHECK_EQ(layout.slices[layout.pin_slice[2]], 6);
+    CHECK_EQ(layout.pin_shift[0], 16);
+    CHECK_EQ(layout.pin_shift[1], 16);
+    CHECK_EQ(layout.pin_shift[2], 0);
+}
+
+// Palavras de 32 bits escritas no registrador CC de cada slice
+static void test_pack(void) {
+    static uint32_t tables[3][STATUS_LED_TABLE_LEN];
+    status_led_layout_t layout;
+    status_led_layout_init(&layout, pins);
+    unsigned slice6 = layout.pin_slice[0];
+    unsigned slice5 = layout.pin_slice[1];
+
+    status_led_effect_t e = {200, 100, 50, STATUS_LED_BREATHE, 1000};
+    status_led_pack(&layout, &e, tables);
+
+    int wrong = 0;
+    uint16_t duty[3];
+    for (unsigned i = 0; i < STATUS_LED_TABLE_LEN; i++) {
+        status_led_waveform(&e, i, duty);
+        if (tables[slice6][i] != ((uint32_t)duty[0] << 16 | duty[2]))
+            wrong++;
+        if (tables[slice5][i] != (uint32_t)duty[1] << 16)
+            wrong++;
+    }
+    CHECK_EQ(wrong, 0);
+
+    // Amostra do pico: R no canal B (bits altos), B no canal A (bits baixos)
+    CHECK_EQ(tables[slice6][STATUS_LED_TABLE_LEN / 2],
+             (uint32_t)status_led_gamma(200) << 16 | status_led_gamma(50));
+    CHECK_EQ(tables[slice5][STATUS_LED_TABLE_LEN / 2], (uint32_t)status_led_gamma(100) << 16);
+}
+
+// Período reproduzido em milissegundos para uma cadência
+static double paced_ms(uint32_t clk_hz, const status_led_pace_t *pace) {
+    return (double)pace->div * pace->wrap * STATUS_LED_TABLE_LEN * 1000.0 / clk_hz;
+}
+
+// Até o período máximo a cadência fica a menos de 0,1% do pedido nos clocks usados pelo
+// gerenciador de energia e no limite documentado; acima dele o período é limitado
+static void test_pace(void) {
+    const uint32_t clocks[] = {24000000, 48000000, 125000000, 142000000};
+    const uint16_t periods[] = {10, 500, 2000, 10000, STATUS_LED_MAX_PERIOD_MS};
+    status_led_pace_t pace;
+
+    int inaccurate = 0;
+    for (unsigned c = 0; c < sizeof(clocks) / sizeof(clocks[0]); c++) {
+        for (unsigned p = 0; p < sizeof(periods) / sizeof(periods[0]); p++) {
+            status_led_pace(clocks[c], periods[p], &pace);
+            double error = paced_ms(clocks[c], &pace) / periods[p] - 1.0;
+            if (error > 0.001 || error < -0.001 || pace.wrap > 65536 || pace.div == 0) {
+                printf("clk %lu Hz, período %u ms: %.1f ms\n", (unsigned long)clocks[c], periods[p],
+                       paced_ms(clocks[c], &pace));
+                inaccurate++;
+            }
+        }
+    }
+    CHECK_EQ(inaccurate, 0);
+
+    status_led_pace_t limit;
+    status_led_pace(125000000, STATUS_LED_MAX_PERIOD_MS, &limit);
+    status_led_pace(125000000, 65535, &pace);
+    CHECK_EQ(pace.div, limit.div);
+    CHECK_EQ(pace.wrap, limit.wrap);
+}
+
+int main(void) {
+    test_gamma();
+    test_solid();
+    test_breathe();
+    test_blink();
+    test_layout();
+    test_pack();
+    test_pace();
+    return TEST_RESULT();
+}
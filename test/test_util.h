@@ -0,0 +1,26 @@
+#ifndef TEST_UTIL_H
+#define TEST_UTIL_H
+
+#include <stdio.h>
+
+// Contador de falhas compartilhado pelas verificações de um executável de teste
+static int test_failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("%s:%d: falhou: %s\n", __FILE__, __LINE__, #cond); \
+        test_failures++; \
+    } \
+} while (0)
+
+#define CHECK_EQ(actual, expected) do { \
+    long long a_ = (long long)(actual), e_ = (long long)(expected); \
+    if (a_ != e_) { \
+        printf("%s:%d: falhou: %s == %lld (esperado %lld)\n", __FILE__, __LINE__, #actual, a_, e_); \
+        test_failures++; \
+    } \
+} while (0)
+
+#define TEST_RESULT() (test_failures ? (printf("%d falha(s)\n", test_failures), 1) : (printf("OK\n"), 0))
+
+#endif // TEST_UTIL_H